@@ -0,0 +1,383 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BENCHMARK_REPORTER_HPP_
+#define ROCRAND_BENCHMARK_REPORTER_HPP_
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <algorithm>
+#include <cmath>
+
+namespace benchmark {
+
+// Statistics of per-trial times (in milliseconds)
+struct trial_statistics
+{
+    double total;
+    double mean;
+    double median;
+    double stddev;
+    double min;
+    double p95;
+    double p99;
+
+    trial_statistics(std::vector<double> times)
+        : total(0.0), mean(0.0), median(0.0), stddev(0.0), min(0.0), p95(0.0), p99(0.0)
+    {
+        if (times.empty())
+            return;
+        std::sort(times.begin(), times.end());
+        const size_t n = times.size();
+        total = std::accumulate(times.begin(), times.end(), 0.0);
+        mean = total / n;
+        median = n % 2 == 1 ? times[n / 2] : (times[n / 2 - 1] + times[n / 2]) / 2;
+        min = times.front();
+        p95 = percentile(times, 95);
+        p99 = percentile(times, 99);
+        double sum2 = 0.0;
+        for (double t : times)
+        {
+            sum2 += (t - mean) * (t - mean);
+        }
+        stddev = n > 1 ? std::sqrt(sum2 / (n - 1)) : 0.0;
+    }
+
+private:
+    // Nearest-rank percentile of sorted times
+    static double percentile(const std::vector<double>& sorted_times, size_t p)
+    {
+        const size_t rank = (p * sorted_times.size() + 99) / 100;
+        return sorted_times[std::max<size_t>(rank, 1) - 1];
+    }
+};
+
+// Resource usage of a benchmarked kernel (see reporter::resources)
+struct kernel_resources
+{
+    bool valid; // false if attributes of the kernel are not available
+    size_t state_bytes; // size of the generator's state
+    int registers; // VGPRs per thread
+    size_t shared_bytes; // static LDS per block
+    size_t local_bytes; // scratch memory per thread
+    unsigned int block_size;
+    int active_blocks; // resident blocks per compute unit
+    double occupancy; // resident waves (warps) / maximum waves per compute unit
+    bool estimated; // occupancy is estimated from registers and LDS
+
+    kernel_resources()
+        : valid(false), state_bytes(0), registers(0), shared_bytes(0), local_bytes(0),
+          block_size(0), active_blocks(0), occupancy(0.0), estimated(false)
+    { }
+};
+
+// Prints results of benchmarks as human-readable lines (text), a JSON document
+// (json) or comma-separated values with a header row (csv).
+// Machine-readable results can be compared by benchmark/compare_results.py.
+class reporter
+{
+public:
+    enum format_type
+    {
+        text,
+        json,
+        csv
+    };
+
+    reporter(const std::string& format, std::ostream& output = std::cout)
+        : m_format(text), m_valid(true), m_output(output), m_results(0)
+    {
+        if (format == "json")
+            m_format = json;
+        else if (format == "csv")
+            m_format = csv;
+        else if (format != "text")
+            m_valid = false;
+    }
+
+    bool is_valid() const
+    {
+        return m_valid;
+    }
+
+    void begin(int version, int runtime_version, const std::string& device)
+    {
+        if (m_format == text)
+        {
+            m_output << "rocRAND: " << version << " ";
+            m_output << "Runtime: " << runtime_version << " ";
+            m_output << "Device: " << device;
+            m_output << std::endl << std::endl;
+        }
+        else if (m_format == json)
+        {
+            m_output << "{" << std::endl
+                     << "  \"rocrand_version\": " << version << "," << std::endl
+                     << "  \"runtime_version\": " << runtime_version << "," << std::endl
+                     << "  \"device\": " << quote(device) << "," << std::endl
+                     << "  \"results\": [";
+        }
+        else
+        {
+            m_output << "engine,distribution,parameters,size,trials,"
+                     << "mean_ms,median_ms,stddev_ms,min_ms,p95_ms,p99_ms,"
+                     << "throughput_gb_s,samples_gsample_s,"
+                     << "host_mean_ms,host_median_ms,host_p99_ms,"
+                     << "state_bytes,registers,lds_bytes,scratch_bytes,block_size,occupancy"
+                     << std::endl;
+        }
+    }
+
+    void end()
+    {
+        if (m_format == json)
+        {
+            m_output << std::endl << "  ]" << std::endl << "}" << std::endl;
+        }
+    }
+
+    void engine(const std::string& name)
+    {
+        if (m_format == text)
+            m_output << (m_engine.empty() ? "" : "\n") << name << ":" << std::endl;
+        m_engine = name;
+    }
+
+    void distribution(const std::string& name)
+    {
+        m_distribution = name;
+        m_parameters.clear();
+        m_resources = kernel_resources();
+        if (m_format == text)
+            m_output << "  " << name << ":" << std::endl;
+    }
+
+    // Parameters of the distribution (e.g. "lambda 10.0")
+    void parameters(const std::string& description)
+    {
+        m_parameters = description;
+        m_resources = kernel_resources();
+        if (m_format == text)
+            m_output << "    " << description << std::endl;
+    }
+
+    // Resource usage of the kernel of the following results (until
+    // the next distribution or parameters)
+    void resources(const kernel_resources& resources)
+    {
+        m_resources = resources;
+    }
+
+    // Reports times of all trials (in milliseconds) of generating size values
+    // of value_size bytes. host_times are optional times spent in API calls
+    // on the host (before they return), they are not reported if empty.
+    void result(size_t size, size_t value_size,
+                const std::vector<double>& times,
+                const std::vector<double>& host_times = std::vector<double>())
+    {
+        const trial_statistics stats(times);
+        const trial_statistics host_stats(host_times);
+        const size_t trials = times.size();
+        const double throughput = (trials * size * value_size) / (stats.total / 1e3 * (1 << 30));
+        const double samples = (trials * size) / (stats.total / 1e3 * (1 << 30));
+
+        if (m_format == text)
+        {
+            m_output << std::fixed << std::setprecision(3)
+                     << "      "
+                     << "Throughput = "
+                     << std::setw(8) << throughput
+                     << " GB/s, Samples = "
+                     << std::setw(8) << samples
+                     << " GSample/s, AvgTime (1 trial) = "
+                     << std::setw(8) << stats.mean
+                     << " ms, Time (all) = "
+                     << std::setw(8) << stats.total
+                     << " ms, Size = " << size
+                     << std::endl
+                     << "      "
+                     << "Trial time: min = "
+                     << std::setw(8) << stats.min
+                     << " ms, median = "
+                     << std::setw(8) << stats.median
+                     << " ms, p95 = "
+                     << std::setw(8) << stats.p95
+                     << " ms, p99 = "
+                     << std::setw(8) << stats.p99
+                     << " ms, stddev = "
+                     << std::setw(8) << stats.stddev
+                     << " ms"
+                     << std::endl;
+            if (!host_times.empty())
+            {
+                m_output << "      "
+                         << "Host API time: mean = "
+                         << std::setw(8) << host_stats.mean
+                         << " ms, median = "
+                         << std::setw(8) << host_stats.median
+                         << " ms, p99 = "
+                         << std::setw(8) << host_stats.p99
+                         << " ms"
+                         << std::endl;
+            }
+            if (m_resources.valid)
+            {
+                m_output << std::setprecision(1)
+                         << "      "
+                         << "Resources: state = " << m_resources.state_bytes
+                         << " B, VGPRs = " << m_resources.registers
+                         << ", LDS = " << m_resources.shared_bytes
+                         << " B, scratch = " << m_resources.local_bytes
+                         << " B, block = " << m_resources.block_size
+                         << ", occupancy = " << (m_resources.occupancy * 100.0)
+                         << "% (" << m_resources.active_blocks << " blocks/CU"
+                         << (m_resources.estimated ? ", estimated" : "") << ")"
+                         << std::endl;
+            }
+        }
+        else if (m_format == json)
+        {
+            m_output << (m_results > 0 ? "," : "") << std::endl
+                     << std::setprecision(6)
+                     << "    {"
+                     << "\"engine\": " << quote(m_engine) << ", "
+                     << "\"distribution\": " << quote(m_distribution) << ", "
+                     << "\"parameters\": " << quote(m_parameters) << ", "
+                     << "\"size\": " << size << ", "
+                     << "\"trials\": " << trials << ", "
+                     << "\"mean_ms\": " << stats.mean << ", "
+                     << "\"median_ms\": " << stats.median << ", "
+                     << "\"stddev_ms\": " << stats.stddev << ", "
+                     << "\"min_ms\": " << stats.min << ", "
+                     << "\"p95_ms\": " << stats.p95 << ", "
+                     << "\"p99_ms\": " << stats.p99 << ", "
+                     << "\"throughput_gb_s\": " << throughput << ", "
+                     << "\"samples_gsample_s\": " << samples;
+            if (!host_times.empty())
+            {
+                m_output << ", "
+                         << "\"host_mean_ms\": " << host_stats.mean << ", "
+                         << "\"host_median_ms\": " << host_stats.median << ", "
+                         << "\"host_p99_ms\": " << host_stats.p99;
+            }
+            if (m_resources.valid)
+            {
+                m_output << ", "
+                         << "\"state_bytes\": " << m_resources.state_bytes << ", "
+                         << "\"registers\": " << m_resources.registers << ", "
+                         << "\"lds_bytes\": " << m_resources.shared_bytes << ", "
+                         << "\"scratch_bytes\": " << m_resources.local_bytes << ", "
+                         << "\"block_size\": " << m_resources.block_size << ", "
+                         << "\"active_blocks\": " << m_resources.active_blocks << ", "
+                         << "\"occupancy\": " << m_resources.occupancy << ", "
+                         << "\"occupancy_estimated\": "
+                         << (m_resources.estimated ? "true" : "false");
+            }
+            m_output << "}";
+        }
+        else
+        {
+            m_output << std::setprecision(6)
+                     << m_engine << ","
+                     << m_distribution << ","
+                     << csv_field(m_parameters) << ","
+                     << size << ","
+                     << trials << ","
+                     << stats.mean << ","
+                     << stats.median << ","
+                     << stats.stddev << ","
+                     << stats.min << ","
+                     << stats.p95 << ","
+                     << stats.p99 << ","
+                     << throughput << ","
+                     << samples << ",";
+            if (!host_times.empty())
+            {
+                m_output << host_stats.mean << ","
+                         << host_stats.median << ","
+                         << host_stats.p99;
+            }
+            else
+            {
+                m_output << ",,";
+            }
+            m_output << ",";
+            if (m_resources.valid)
+            {
+                m_output << m_resources.state_bytes << ","
+                         << m_resources.registers << ","
+                         << m_resources.shared_bytes << ","
+                         << m_resources.local_bytes << ","
+                         << m_resources.block_size << ","
+                         << m_resources.occupancy;
+            }
+            else
+            {
+                m_output << ",,,,,";
+            }
+            m_output << std::endl;
+        }
+        m_results++;
+    }
+
+private:
+    static std::string quote(const std::string& s)
+    {
+        std::string result = "\"";
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    static std::string csv_field(const std::string& s)
+    {
+        if (s.find_first_of(",\"") == std::string::npos)
+            return s;
+        std::string result = "\"";
+        for (char c : s)
+        {
+            if (c == '"')
+                result += '"';
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    format_type m_format;
+    bool m_valid;
+    std::ostream& m_output;
+    size_t m_results;
+    std::string m_engine;
+    std::string m_distribution;
+    std::string m_parameters;
+    kernel_resources m_resources;
+};
+
+} // end namespace benchmark
+
+#endif // ROCRAND_BENCHMARK_REPORTER_HPP_
@@ -0,0 +1,218 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Measures throughput of device engines and distribution functions compiled
+// for the host (as in tests of the device API). The benchmark is built with
+// the HIP compiler like other benchmarks, but HIP runtime is not used when it
+// runs, so it runs on machines without GPUs and catches regressions of
+// algorithms shared by host and device code.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand_sobol_precomputed.h>
+
+// Host tables of discrete distributions are built by the library code, engines
+// of the device API declared above keep their Box-Muller caches
+#define ROCRAND_DETAIL_ENGINES_DECLARED_BEFORE
+#include <rng/distribution/poisson.hpp>
+
+// Prevents the compiler from removing computations whose results are unused
+volatile double benchmark_sink;
+
+template<typename T>
+double to_double(const T x)
+{
+    return static_cast<double>(x);
+}
+
+template<typename State, typename Func>
+void run_benchmark(const std::string& name,
+                   const State& initial_state,
+                   const size_t size,
+                   Func func)
+{
+    State state = initial_state;
+    double sum = 0.0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < size; i++)
+    {
+        sum += to_double(func(&state));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::nano> elapsed = end - start;
+
+    // The state is used after the loop, so skipahead functions are not removed
+    benchmark_sink = sum + rocrand(&state);
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "    "
+              << std::left << std::setw(32) << name << std::right
+              << "Time = "
+              << std::setw(12) << elapsed.count() / size
+              << " ns/call, Calls = "
+              << std::setw(10) << size / (elapsed.count() / 1e3)
+              << " M/s"
+              << std::endl;
+}
+
+template<typename State>
+void run_benchmarks(const cli::Parser& parser, const State& state)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t skip_size = std::max<size_t>(size / 256, 1);
+    const unsigned long long skip_distance = parser.get<size_t>("skip");
+
+    run_benchmark("next", state, size,
+        [](State * state) { return rocrand(state); });
+    run_benchmark("discard (skipahead " + std::to_string(skip_distance) + ")", state, skip_size,
+        [skip_distance](State * state) { skipahead(skip_distance, state); return 0; });
+    run_benchmark("uniform", state, size,
+        [](State * state) { return rocrand_uniform(state); });
+    run_benchmark("uniform_double", state, size,
+        [](State * state) { return rocrand_uniform_double(state); });
+    run_benchmark("normal", state, size,
+        [](State * state) { return rocrand_normal(state); });
+    run_benchmark("normal_double", state, size,
+        [](State * state) { return rocrand_normal_double(state); });
+    run_benchmark("log_normal", state, size,
+        [](State * state) { return rocrand_log_normal(state, 0.0f, 1.0f); });
+    run_benchmark("truncated_normal (roc_f_erfinv)", state, size,
+        [](State * state) { return rocrand_truncated_normal(state, -1.0f, 1.0f); });
+    run_benchmark("poisson_distribution_small", state, size,
+        [](State * state) { return rocrand_poisson(state, 10.0); });
+    run_benchmark("poisson_distribution_large", state, size,
+        [](State * state) { return rocrand_poisson(state, 1000.0); });
+    run_benchmark("poisson_distribution_huge", state, size,
+        [](State * state) { return rocrand_poisson(state, 100000.0); });
+
+    // Host tables built by the library code which builds device tables of
+    // rocrand_create_poisson_distribution (alias table, CDF and guide table)
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL, true> poisson;
+    poisson.set_lambda(parser.get<double>("lambda"));
+    const rocrand_discrete_distribution_st dis = poisson;
+    run_benchmark("discrete_alias", state, size,
+        [dis](State * state) { return rocrand_device::detail::discrete_alias(rocrand(state), dis); });
+    run_benchmark("discrete_cdf", state, size,
+        [dis](State * state) { return rocrand_device::detail::discrete_cdf(rocrand(state), dis); });
+    run_benchmark("discrete_cdf_guide", state, size,
+        [dis](State * state) { return rocrand_device::detail::discrete_cdf_guide(rocrand(state), dis); });
+    poisson.deallocate();
+}
+
+template<typename State>
+void run_subsequence_benchmark(const cli::Parser& parser, const State& state)
+{
+    const size_t skip_size = std::max<size_t>(parser.get<size_t>("size") / 256, 1);
+
+    run_benchmark("discard_subsequence (1)", state, skip_size,
+        [](State * state) { skipahead_subsequence(1, state); return 0; });
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "philox",
+    "sobol32",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all (mtgp32 is not supported, its state is shared by a block)";
+
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 4, "number of calls of each function (skipahead functions: size / 256)");
+    parser.set_optional<size_t>("skip", "skip", 1000, "distance of skipahead");
+    parser.set_optional<double>("lambda", "lambda", 100.0, "lambda of Poisson distribution of discrete functions");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    for (auto engine : engines)
+    {
+        std::cout << engine << ":" << std::endl;
+        if (engine == "xorwow")
+        {
+            rocrand_state_xorwow state;
+            rocrand_init(12345ULL, 0, 0, &state);
+            run_benchmarks(parser, state);
+            run_subsequence_benchmark(parser, state);
+        }
+        else if (engine == "mrg32k3a")
+        {
+            rocrand_state_mrg32k3a state;
+            rocrand_init(12345ULL, 0, 0, &state);
+            run_benchmarks(parser, state);
+            run_subsequence_benchmark(parser, state);
+        }
+        else if (engine == "philox")
+        {
+            rocrand_state_philox4x32_10 state;
+            rocrand_init(12345ULL, 0, 0, &state);
+            run_benchmarks(parser, state);
+            run_subsequence_benchmark(parser, state);
+        }
+        else if (engine == "sobol32")
+        {
+            rocrand_state_sobol32 state;
+            rocrand_init(h_sobol32_direction_vectors, 0, &state);
+            run_benchmarks(parser, state);
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -26,8 +26,11 @@
 #include <numeric>
 #include <utility>
 #include <algorithm>
+#include <cmath>
+#include <sstream>
 
 #include "cmdparser.hpp"
+#include "benchmark_reporter.hpp"
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -61,11 +64,14 @@ using generate_func_type = std::function<rocrand_status(rocrand_generator, T *,
 
 template<typename T>
 void run_benchmark(const cli::Parser& parser,
+                   benchmark::reporter& reporter,
                    const rng_type_t rng_type,
                    generate_func_type<T> generate_func)
 {
     const size_t size = parser.get<size_t>("size");
     const size_t trials = parser.get<size_t>("trials");
+    const size_t warmup = parser.get<size_t>("warmup");
+    const bool host_time = parser.get<bool>("host-time");
 
     T * data;
     HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
@@ -81,48 +87,99 @@ void run_benchmark(const cli::Parser& parser,
     }
 
     // Warm-up
-    for (size_t i = 0; i < 5; i++)
+    for (size_t i = 0; i < warmup; i++)
     {
         ROCRAND_CHECK(generate_func(generator, data, size));
     }
     HIP_CHECK(hipDeviceSynchronize());
 
-    // Measurement
-    auto start = std::chrono::high_resolution_clock::now();
+    // Measurement: each trial is timed with events on the device,
+    // the host time is the time spent in the call before it returns
+    hipEvent_t start_event, stop_event;
+    HIP_CHECK(hipEventCreate(&start_event));
+    HIP_CHECK(hipEventCreate(&stop_event));
+    std::vector<double> times;
+    std::vector<double> host_times;
     for (size_t i = 0; i < trials; i++)
     {
+        HIP_CHECK(hipEventRecord(start_event, 0));
+        auto host_start = std::chrono::high_resolution_clock::now();
         ROCRAND_CHECK(generate_func(generator, data, size));
+        auto host_end = std::chrono::high_resolution_clock::now();
+        HIP_CHECK(hipEventRecord(stop_event, 0));
+        HIP_CHECK(hipEventSynchronize(stop_event));
+
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start_event, stop_event));
+        times.push_back(elapsed);
+        if (host_time)
+        {
+            std::chrono::duration<double, std::milli> host_elapsed = host_end - host_start;
+            host_times.push_back(host_elapsed.count());
+        }
     }
-    HIP_CHECK(hipDeviceSynchronize());
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double, std::milli> elapsed = end - start;
-
-    std::cout << std::fixed << std::setprecision(3)
-              << "      "
-              << "Throughput = "
-              << std::setw(8) << (trials * size * sizeof(T)) /
-                    (elapsed.count() / 1e3 * (1 << 30))
-              << " GB/s, Samples = "
-              << std::setw(8) << (trials * size) /
-                    (elapsed.count() / 1e3 * (1 << 30))
-              << " GSample/s, AvgTime (1 trial) = "
-              << std::setw(8) << elapsed.count() / trials
-              << " ms, Time (all) = "
-              << std::setw(8) << elapsed.count()
-              << " ms, Size = " << size
-              << std::endl;
+    HIP_CHECK(hipEventDestroy(start_event));
+    HIP_CHECK(hipEventDestroy(stop_event));
+
+    reporter.result(size, sizeof(T), times, host_times);
 
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
     HIP_CHECK(hipFree(data));
 }
 
+template<typename T>
+void run_multivariate_normal_benchmark(const cli::Parser& parser,
+                                       benchmark::reporter& reporter,
+                                       const rng_type_t rng_type,
+                                       std::function<rocrand_status(rocrand_generator, T *, size_t, unsigned int,
+                                                                    const T *, const T *)> generate_func)
+{
+    const unsigned int dimensions = parser.get<unsigned int>("mvn-dim");
+    reporter.parameters("dimensions " + std::to_string(dimensions));
+
+    // Covariance matrix with 1 on the diagonal and 0.5 elsewhere
+    std::vector<T> mean(dimensions, T(0));
+    std::vector<T> factor(dimensions * dimensions, T(0));
+    for (unsigned int i = 0; i < dimensions; i++)
+    {
+        T sum = 0;
+        for (unsigned int j = 0; j < i; j++)
+        {
+            T value = 0.5;
+            for (unsigned int k = 0; k < j; k++)
+                value -= factor[i * dimensions + k] * factor[j * dimensions + k];
+            value /= factor[j * dimensions + j];
+            factor[i * dimensions + j] = value;
+            sum += value * value;
+        }
+        factor[i * dimensions + i] = std::sqrt(T(1) - sum);
+    }
+
+    T * d_mean;
+    T * d_factor;
+    HIP_CHECK(hipMalloc((void **)&d_mean, dimensions * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&d_factor, dimensions * dimensions * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_mean, mean.data(), dimensions * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_factor, factor.data(), dimensions * dimensions * sizeof(T), hipMemcpyHostToDevice));
+
+    run_benchmark<T>(parser, reporter, rng_type,
+        [=](rocrand_generator gen, T * data, size_t size) {
+            return generate_func(gen, data, size / dimensions, dimensions, d_mean, d_factor);
+        }
+    );
+
+    HIP_CHECK(hipFree(d_mean));
+    HIP_CHECK(hipFree(d_factor));
+}
+
 void run_benchmarks(const cli::Parser& parser,
+                    benchmark::reporter& reporter,
                     const rng_type_t rng_type,
                     const std::string& distribution)
 {
     if (distribution == "uniform-uint")
     {
-        run_benchmark<unsigned int>(parser, rng_type,
+        run_benchmark<unsigned int>(parser, reporter, rng_type,
             [](rocrand_generator gen, unsigned int * data, size_t size) {
                 return rocrand_generate(gen, data, size);
             }
@@ -130,7 +187,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "uniform-float")
     {
-        run_benchmark<float>(parser, rng_type,
+        run_benchmark<float>(parser, reporter, rng_type,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_uniform(gen, data, size);
             }
@@ -138,7 +195,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "uniform-double")
     {
-        run_benchmark<double>(parser, rng_type,
+        run_benchmark<double>(parser, reporter, rng_type,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_uniform_double(gen, data, size);
             }
@@ -146,7 +203,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "normal-float")
     {
-        run_benchmark<float>(parser, rng_type,
+        run_benchmark<float>(parser, reporter, rng_type,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
             }
@@ -154,7 +211,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "normal-double")
     {
-        run_benchmark<double>(parser, rng_type,
+        run_benchmark<double>(parser, reporter, rng_type,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
             }
@@ -162,7 +219,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "log-normal-float")
     {
-        run_benchmark<float>(parser, rng_type,
+        run_benchmark<float>(parser, reporter, rng_type,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
             }
@@ -170,26 +227,127 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "log-normal-double")
     {
-        run_benchmark<double>(parser, rng_type,
+        run_benchmark<double>(parser, reporter, rng_type,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
             }
         );
     }
+    if (distribution == "truncated-normal-float")
+    {
+        const float lower = parser.get<double>("tn-lower");
+        const float upper = parser.get<double>("tn-upper");
+        std::ostringstream description;
+        description << "interval ["
+             << std::fixed << std::setprecision(1) << lower << ", " << upper << "]";
+        reporter.parameters(description.str());
+        run_benchmark<float>(parser, reporter, rng_type,
+            [lower, upper](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_truncated_normal(gen, data, size, 0.0f, 1.0f, lower, upper);
+            }
+        );
+    }
+    if (distribution == "truncated-normal-double")
+    {
+        const double lower = parser.get<double>("tn-lower");
+        const double upper = parser.get<double>("tn-upper");
+        std::ostringstream description;
+        description << "interval ["
+             << std::fixed << std::setprecision(1) << lower << ", " << upper << "]";
+        reporter.parameters(description.str());
+        run_benchmark<double>(parser, reporter, rng_type,
+            [lower, upper](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_truncated_normal_double(gen, data, size, 0.0, 1.0, lower, upper);
+            }
+        );
+    }
+    // Multivariate normal is not supported by quasi-random generators
+    if (distribution == "multivariate-normal-float" && rng_type != ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        run_multivariate_normal_benchmark<float>(parser, reporter, rng_type,
+            [](rocrand_generator gen, float * data, size_t n_vectors, unsigned int dimensions,
+               const float * mean, const float * factor) {
+                return rocrand_generate_multivariate_normal(gen, data, n_vectors, dimensions, mean, factor);
+            }
+        );
+    }
+    if (distribution == "multivariate-normal-double" && rng_type != ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        run_multivariate_normal_benchmark<double>(parser, reporter, rng_type,
+            [](rocrand_generator gen, double * data, size_t n_vectors, unsigned int dimensions,
+               const double * mean, const double * factor) {
+                return rocrand_generate_multivariate_normal_double(gen, data, n_vectors, dimensions, mean, factor);
+            }
+        );
+    }
+    // Brownian bridge paths are built from dimensions of quasi-random generators
+    if (distribution == "brownian-bridge-float" && rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        run_benchmark<float>(parser, reporter, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_brownian_bridge(gen, data, size, 1.0f);
+            }
+        );
+    }
+    if (distribution == "brownian-bridge-double" && rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        run_benchmark<double>(parser, reporter, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_brownian_bridge_double(gen, data, size, 1.0);
+            }
+        );
+    }
     if (distribution == "poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
         for (double lambda : lambdas)
         {
-            std::cout << "    " << "lambda "
-                 << std::fixed << std::setprecision(1) << lambda << std::endl;
-            run_benchmark<unsigned int>(parser, rng_type,
+            std::ostringstream description;
+            description << "lambda "
+                 << std::fixed << std::setprecision(1) << lambda;
+            reporter.parameters(description.str());
+            run_benchmark<unsigned int>(parser, reporter, rng_type,
                 [lambda](rocrand_generator gen, unsigned int * data, size_t size) {
                     return rocrand_generate_poisson(gen, data, size, lambda);
                 }
             );
         }
     }
+    if (distribution == "binomial")
+    {
+        const auto ns = parser.get<std::vector<unsigned int>>("binomial-n");
+        const double p = parser.get<double>("binomial-p");
+        for (unsigned int n : ns)
+        {
+            std::ostringstream description;
+            description << "n " << n << ", p "
+                 << std::fixed << std::setprecision(2) << p;
+            reporter.parameters(description.str());
+            run_benchmark<unsigned int>(parser, reporter, rng_type,
+                [n, p](rocrand_generator gen, unsigned int * data, size_t size) {
+                    return rocrand_generate_binomial(gen, data, size, n, p);
+                }
+            );
+        }
+    }
+    if (distribution == "negative-binomial")
+    {
+        const auto rs = parser.get<std::vector<double>>("nb-r");
+        const double p = parser.get<double>("nb-p");
+        for (double r : rs)
+        {
+            std::ostringstream description;
+            description << "r "
+                 << std::fixed << std::setprecision(1) << r << ", p "
+                 << std::fixed << std::setprecision(2) << p;
+            reporter.parameters(description.str());
+            run_benchmark<unsigned int>(parser, reporter, rng_type,
+                [r, p](rocrand_generator gen, unsigned int * data, size_t size) {
+                    return rocrand_generate_negative_binomial(gen, data, size, r, p);
+                }
+            );
+        }
+    }
 }
 
 const std::vector<std::string> all_engines = {
@@ -209,7 +367,15 @@ const std::vector<std::string> all_distributions = {
     "normal-double",
     "log-normal-float",
     "log-normal-double",
-    "poisson"
+    "truncated-normal-float",
+    "truncated-normal-double",
+    "multivariate-normal-float",
+    "multivariate-normal-double",
+    "brownian-bridge-float",
+    "brownian-bridge-double",
+    "poisson",
+    "binomial",
+    "negative-binomial"
 };
 
 int main(int argc, char *argv[])
@@ -236,11 +402,28 @@ int main(int argc, char *argv[])
     parser.set_optional<size_t>("size", "size", DEFAULT_RAND_N, "number of values");
     parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
     parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<size_t>("warmup", "warmup", 5, "number of warm-up calls before measurement");
+    parser.set_optional<bool>("host-time", "host-time", false, "also report time spent in API calls on the host");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
     parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::vector<unsigned int>>("binomial-n", "binomial-n", {100}, "space-separated list of numbers of trials of binomial distribution");
+    parser.set_optional<double>("binomial-p", "binomial-p", 0.5, "probability of success of binomial distribution");
+    parser.set_optional<std::vector<double>>("nb-r", "nb-r", {10.0}, "space-separated list of numbers of successes of negative binomial distribution");
+    parser.set_optional<double>("nb-p", "nb-p", 0.5, "probability of success of negative binomial distribution");
+    parser.set_optional<double>("tn-lower", "tn-lower", -1.0, "lower bound of truncated normal distribution (standard normal units)");
+    parser.set_optional<double>("tn-upper", "tn-upper", 1.0, "upper bound of truncated normal distribution (standard normal units)");
+    parser.set_optional<unsigned int>("mvn-dim", "mvn-dim", 8, "number of dimensions of multivariate normal distribution");
+    parser.set_optional<std::string>("format", "format", "text", "output format: text, json or csv");
     parser.run_and_exit_if_error();
 
+    benchmark::reporter reporter(parser.get<std::string>("format"));
+    if (!reporter.is_valid())
+    {
+        std::cout << "Wrong output format" << std::endl;
+        exit(1);
+    }
+
     std::vector<std::string> engines;
     {
         auto es = parser.get<std::vector<std::string>>("engine");
@@ -284,10 +467,7 @@ int main(int argc, char *argv[])
     hipDeviceProp_t props;
     HIP_CHECK(hipGetDeviceProperties(&props, device_id));
 
-    std::cout << "rocRAND: " << version << " ";
-    std::cout << "Runtime: " << runtime_version << " ";
-    std::cout << "Device: " << props.name;
-    std::cout << std::endl << std::endl;
+    reporter.begin(version, runtime_version, props.name);
 
     for (auto engine : engines)
     {
@@ -308,15 +488,15 @@ int main(int argc, char *argv[])
             exit(1);
         }
 
-        std::cout << engine << ":" << std::endl;
+        reporter.engine(engine);
 
         for (auto distribution : distributions)
         {
-            std::cout << "  " << distribution << ":" << std::endl;
-            run_benchmarks(parser, rng_type, distribution);
+            reporter.distribution(distribution);
+            run_benchmarks(parser, reporter, rng_type, distribution);
         }
-        std::cout << std::endl;
     }
+    reporter.end();
 
     return 0;
 }
@@ -26,8 +26,10 @@
 #include <numeric>
 #include <utility>
 #include <algorithm>
+#include <sstream>
 
 #include "cmdparser.hpp"
+#include "benchmark_reporter.hpp"
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -67,6 +69,63 @@ size_t next_power2(size_t x)
     return power;
 }
 
+// Returns VGPRs, LDS and scratch of kernel and its occupancy with blocks
+// of block_size threads. If the runtime can't compute occupancy, it is
+// estimated for GCN: 64-wide waves, 4 SIMDs with 256 VGPRs per lane
+// (allocated in groups of 4) and up to 10 waves each, 64 KB of LDS per CU.
+// SGPRs are not reported by HIP.
+template<typename Kernel>
+benchmark::kernel_resources get_kernel_resources(Kernel kernel,
+                                                 const size_t block_size,
+                                                 const size_t state_bytes)
+{
+    benchmark::kernel_resources resources;
+    hipFuncAttributes attributes;
+    if (hipFuncGetAttributes(&attributes, reinterpret_cast<const void *>(kernel)) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return resources;
+    }
+    resources.valid = true;
+    resources.state_bytes = state_bytes;
+    resources.registers = attributes.numRegs;
+    resources.shared_bytes = attributes.sharedSizeBytes;
+    resources.local_bytes = attributes.localSizeBytes;
+    resources.block_size = static_cast<unsigned int>(block_size);
+
+    int device_id;
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+    const int wave_size = props.warpSize > 0 ? props.warpSize : 64;
+    const int waves_per_block = static_cast<int>((block_size + wave_size - 1) / wave_size);
+
+    int active_blocks;
+    if (hipOccupancyMaxActiveBlocksPerMultiprocessor(
+            &active_blocks, kernel, static_cast<int>(block_size), 0) == hipSuccess
+        && props.maxThreadsPerMultiProcessor > 0)
+    {
+        resources.active_blocks = active_blocks;
+        resources.occupancy = static_cast<double>(active_blocks * waves_per_block)
+            / (props.maxThreadsPerMultiProcessor / wave_size);
+        return resources;
+    }
+    (void)hipGetLastError();
+
+    const int max_waves = 40;
+    const int vgprs = std::max((attributes.numRegs + 3) / 4 * 4, 4);
+    const int waves_by_vgprs = 4 * std::min(10, 256 / vgprs);
+    int blocks = std::min(max_waves, waves_by_vgprs) / waves_per_block;
+    if (attributes.sharedSizeBytes > 0)
+    {
+        blocks = std::min(blocks, static_cast<int>(65536 / attributes.sharedSizeBytes));
+    }
+    resources.active_blocks = blocks;
+    resources.occupancy = static_cast<double>(blocks * waves_per_block) / max_waves;
+    resources.estimated = true;
+    return resources;
+}
+
 template<typename GeneratorState>
 __global__
 void init_kernel(GeneratorState * states,
@@ -143,6 +202,16 @@ struct runner
             states, data, size, generate_func, extra
         );
     }
+
+    template<typename T, typename GenerateFunc, typename Extra>
+    benchmark::kernel_resources resources(const size_t threads,
+                                          const GenerateFunc& /* generate_func */,
+                                          const Extra /* extra */)
+    {
+        void (*kernel)(GeneratorState *, T *, const size_t, GenerateFunc, const Extra) =
+            generate_kernel;
+        return get_kernel_resources(kernel, threads, sizeof(GeneratorState));
+    }
 };
 
 template<typename T, typename GenerateFunc, typename Extra>
@@ -215,6 +284,16 @@ struct runner<rocrand_state_mtgp32>
             states, data, size, generate_func, extra
         );
     }
+
+    template<typename T, typename GenerateFunc, typename Extra>
+    benchmark::kernel_resources resources(const size_t /* threads */,
+                                          const GenerateFunc& /* generate_func */,
+                                          const Extra /* extra */)
+    {
+        void (*kernel)(rocrand_state_mtgp32 *, T *, const size_t, GenerateFunc, const Extra) =
+            generate_kernel;
+        return get_kernel_resources(kernel, 256, sizeof(rocrand_state_mtgp32));
+    }
 };
 
 template<typename Directions>
@@ -311,16 +390,29 @@ struct runner<rocrand_state_sobol32>
             states, data, size / dimensions, generate_func, extra
         );
     }
+
+    template<typename T, typename GenerateFunc, typename Extra>
+    benchmark::kernel_resources resources(const size_t threads,
+                                          const GenerateFunc& /* generate_func */,
+                                          const Extra /* extra */)
+    {
+        void (*kernel)(rocrand_state_sobol32 *, T *, const size_t, GenerateFunc, const Extra) =
+            generate_kernel;
+        return get_kernel_resources(kernel, threads, sizeof(rocrand_state_sobol32));
+    }
 };
 
 template<typename T, typename GeneratorState, typename GenerateFunc, typename Extra>
 void run_benchmark(const cli::Parser& parser,
+                   benchmark::reporter& reporter,
                    const GenerateFunc& generate_func,
                    const Extra extra)
 {
     const size_t size = parser.get<size_t>("size");
     const size_t dimensions = parser.get<size_t>("dimensions");
     const size_t trials = parser.get<size_t>("trials");
+    const size_t warmup = parser.get<size_t>("warmup");
+    const bool host_time = parser.get<bool>("host-time");
 
     const size_t blocks = parser.get<size_t>("blocks");
     const size_t threads = parser.get<size_t>("threads");
@@ -329,9 +421,10 @@ void run_benchmark(const cli::Parser& parser,
     HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
 
     runner<GeneratorState> r(dimensions, blocks, threads, 12345ULL, 6789ULL);
+    reporter.resources(r.template resources<T>(threads, generate_func, extra));
 
     // Warm-up
-    for (size_t i = 0; i < 5; i++)
+    for (size_t i = 0; i < warmup; i++)
     {
         r.generate(blocks, threads, data, size, generate_func, extra);
         HIP_CHECK(hipPeekAtLastError());
@@ -339,42 +432,48 @@ void run_benchmark(const cli::Parser& parser,
     }
     HIP_CHECK(hipDeviceSynchronize());
 
-    // Measurement
-    auto start = std::chrono::high_resolution_clock::now();
+    // Measurement: each trial is timed with events on the device,
+    // the host time is the time spent in the call before it returns
+    hipEvent_t start_event, stop_event;
+    HIP_CHECK(hipEventCreate(&start_event));
+    HIP_CHECK(hipEventCreate(&stop_event));
+    std::vector<double> times;
+    std::vector<double> host_times;
     for (size_t i = 0; i < trials; i++)
     {
+        HIP_CHECK(hipEventRecord(start_event, 0));
+        auto host_start = std::chrono::high_resolution_clock::now();
         r.generate(blocks, threads, data, size, generate_func, extra);
+        HIP_CHECK(hipPeekAtLastError());
+        auto host_end = std::chrono::high_resolution_clock::now();
+        HIP_CHECK(hipEventRecord(stop_event, 0));
+        HIP_CHECK(hipEventSynchronize(stop_event));
+
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start_event, stop_event));
+        times.push_back(elapsed);
+        if (host_time)
+        {
+            std::chrono::duration<double, std::milli> host_elapsed = host_end - host_start;
+            host_times.push_back(host_elapsed.count());
+        }
     }
-    HIP_CHECK(hipPeekAtLastError());
-    HIP_CHECK(hipDeviceSynchronize());
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double, std::milli> elapsed = end - start;
-
-    std::cout << std::fixed << std::setprecision(3)
-              << "      "
-              << "Throughput = "
-              << std::setw(8) << (trials * size * sizeof(T)) /
-                    (elapsed.count() / 1e3 * (1 << 30))
-              << " GB/s, Samples = "
-              << std::setw(8) << (trials * size) /
-                    (elapsed.count() / 1e3 * (1 << 30))
-              << " GSample/s, AvgTime (1 trial) = "
-              << std::setw(8) << elapsed.count() / trials
-              << " ms, Time (all) = "
-              << std::setw(8) << elapsed.count()
-              << " ms, Size = " << size
-              << std::endl;
+    HIP_CHECK(hipEventDestroy(start_event));
+    HIP_CHECK(hipEventDestroy(stop_event));
+
+    reporter.result(size, sizeof(T), times, host_times);
 
     HIP_CHECK(hipFree(data));
 }
 
 template<typename GeneratorState>
 void run_benchmarks(const cli::Parser& parser,
+                    benchmark::reporter& reporter,
                     const std::string& distribution)
 {
     if (distribution == "uniform-uint")
     {
-        run_benchmark<unsigned int, GeneratorState>(parser,
+        run_benchmark<unsigned int, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand(state);
             }, 0
@@ -382,7 +481,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "uniform-float")
     {
-        run_benchmark<float, GeneratorState>(parser,
+        run_benchmark<float, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand_uniform(state);
             }, 0
@@ -390,7 +489,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "uniform-double")
     {
-        run_benchmark<double, GeneratorState>(parser,
+        run_benchmark<double, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand_uniform_double(state);
             }, 0
@@ -398,7 +497,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "normal-float")
     {
-        run_benchmark<float, GeneratorState>(parser,
+        run_benchmark<float, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand_normal(state);
             }, 0
@@ -406,7 +505,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "normal-double")
     {
-        run_benchmark<double, GeneratorState>(parser,
+        run_benchmark<double, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand_normal_double(state);
             }, 0
@@ -414,7 +513,7 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "log-normal-float")
     {
-        run_benchmark<float, GeneratorState>(parser,
+        run_benchmark<float, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand_log_normal(state, 0.0f, 1.0f);
             }, 0
@@ -422,36 +521,103 @@ void run_benchmarks(const cli::Parser& parser,
     }
     if (distribution == "log-normal-double")
     {
-        run_benchmark<double, GeneratorState>(parser,
+        run_benchmark<double, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, int) {
                 return rocrand_log_normal_double(state, 0.0, 1.0);
             }, 0
         );
     }
+    if (distribution == "truncated-normal-float")
+    {
+        const float lower = parser.get<double>("tn-lower");
+        const float upper = parser.get<double>("tn-upper");
+        std::ostringstream description;
+        description << "interval ["
+             << std::fixed << std::setprecision(1) << lower << ", " << upper << "]";
+        reporter.parameters(description.str());
+        run_benchmark<float, GeneratorState>(parser, reporter,
+            [] __device__ (GeneratorState * state, float2 bounds) {
+                return rocrand_truncated_normal(state, bounds.x, bounds.y);
+            }, float2 { lower, upper }
+        );
+    }
+    if (distribution == "truncated-normal-double")
+    {
+        const double lower = parser.get<double>("tn-lower");
+        const double upper = parser.get<double>("tn-upper");
+        std::ostringstream description;
+        description << "interval ["
+             << std::fixed << std::setprecision(1) << lower << ", " << upper << "]";
+        reporter.parameters(description.str());
+        run_benchmark<double, GeneratorState>(parser, reporter,
+            [] __device__ (GeneratorState * state, double2 bounds) {
+                return rocrand_truncated_normal_double(state, bounds.x, bounds.y);
+            }, double2 { lower, upper }
+        );
+    }
     if (distribution == "poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
         for (double lambda : lambdas)
         {
-            std::cout << "    " << "lambda "
-                 << std::fixed << std::setprecision(1) << lambda << std::endl;
-            run_benchmark<unsigned int, GeneratorState>(parser,
+            std::ostringstream description;
+            description << "lambda "
+                 << std::fixed << std::setprecision(1) << lambda;
+            reporter.parameters(description.str());
+            run_benchmark<unsigned int, GeneratorState>(parser, reporter,
                 [] __device__ (GeneratorState * state, double lambda) {
                     return rocrand_poisson(state, lambda);
                 }, lambda
             );
         }
     }
+    if (distribution == "binomial")
+    {
+        const auto ns = parser.get<std::vector<unsigned int>>("binomial-n");
+        const double p = parser.get<double>("binomial-p");
+        for (unsigned int n : ns)
+        {
+            std::ostringstream description;
+            description << "n " << n << ", p "
+                 << std::fixed << std::setprecision(2) << p;
+            reporter.parameters(description.str());
+            run_benchmark<unsigned int, GeneratorState>(parser, reporter,
+                [] __device__ (GeneratorState * state, double2 params) {
+                    return rocrand_binomial(state, static_cast<unsigned int>(params.x), params.y);
+                }, double2 { static_cast<double>(n), p }
+            );
+        }
+    }
+    if (distribution == "negative-binomial")
+    {
+        const auto rs = parser.get<std::vector<double>>("nb-r");
+        const double p = parser.get<double>("nb-p");
+        for (double r : rs)
+        {
+            std::ostringstream description;
+            description << "r "
+                 << std::fixed << std::setprecision(1) << r << ", p "
+                 << std::fixed << std::setprecision(2) << p;
+            reporter.parameters(description.str());
+            run_benchmark<unsigned int, GeneratorState>(parser, reporter,
+                [] __device__ (GeneratorState * state, double2 params) {
+                    return rocrand_negative_binomial(state, params.x, params.y);
+                }, double2 { r, p }
+            );
+        }
+    }
     if (distribution == "discrete-poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
         for (double lambda : lambdas)
         {
-            std::cout << "    " << "lambda "
-                 << std::fixed << std::setprecision(1) << lambda << std::endl;
+            std::ostringstream description;
+            description << "lambda "
+                 << std::fixed << std::setprecision(1) << lambda;
+            reporter.parameters(description.str());
             rocrand_discrete_distribution discrete_distribution;
             ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
-            run_benchmark<unsigned int, GeneratorState>(parser,
+            run_benchmark<unsigned int, GeneratorState>(parser, reporter,
                 [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
                     return rocrand_discrete(state, discrete_distribution);
                 }, discrete_distribution
@@ -476,7 +642,7 @@ void run_benchmarks(const cli::Parser& parser,
 
         rocrand_discrete_distribution discrete_distribution;
         ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(), probabilities.size(), offset, &discrete_distribution));
-        run_benchmark<unsigned int, GeneratorState>(parser,
+        run_benchmark<unsigned int, GeneratorState>(parser, reporter,
             [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
                 return rocrand_discrete(state, discrete_distribution);
             }, discrete_distribution
@@ -506,7 +672,11 @@ const std::vector<std::string> all_distributions = {
     "normal-double",
     "log-normal-float",
     "log-normal-double",
+    "truncated-normal-float",
+    "truncated-normal-double",
     "poisson",
+    "binomial",
+    "negative-binomial",
     "discrete-poisson",
     "discrete-custom",
 };
@@ -535,13 +705,29 @@ int main(int argc, char *argv[])
     parser.set_optional<size_t>("size", "size", DEFAULT_RAND_N, "number of values");
     parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
     parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<size_t>("warmup", "warmup", 5, "number of warm-up calls before measurement");
+    parser.set_optional<bool>("host-time", "host-time", false, "also report time spent in API calls on the host");
     parser.set_optional<size_t>("blocks", "blocks", 256, "number of blocks");
     parser.set_optional<size_t>("threads", "threads", 256, "number of threads in each block");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
     parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::vector<unsigned int>>("binomial-n", "binomial-n", {100}, "space-separated list of numbers of trials of binomial distribution");
+    parser.set_optional<double>("binomial-p", "binomial-p", 0.5, "probability of success of binomial distribution");
+    parser.set_optional<std::vector<double>>("nb-r", "nb-r", {10.0}, "space-separated list of numbers of successes of negative binomial distribution");
+    parser.set_optional<double>("nb-p", "nb-p", 0.5, "probability of success of negative binomial distribution");
+    parser.set_optional<double>("tn-lower", "tn-lower", -1.0, "lower bound of truncated normal distribution (standard normal units)");
+    parser.set_optional<double>("tn-upper", "tn-upper", 1.0, "upper bound of truncated normal distribution (standard normal units)");
+    parser.set_optional<std::string>("format", "format", "text", "output format: text, json or csv");
     parser.run_and_exit_if_error();
 
+    benchmark::reporter reporter(parser.get<std::string>("format"));
+    if (!reporter.is_valid())
+    {
+        std::cout << "Wrong output format" << std::endl;
+        exit(1);
+    }
+
     std::vector<std::string> engines;
     {
         auto es = parser.get<std::vector<std::string>>("engine");
@@ -585,40 +771,38 @@ int main(int argc, char *argv[])
     hipDeviceProp_t props;
     HIP_CHECK(hipGetDeviceProperties(&props, device_id));
 
-    std::cout << "rocRAND: " << version << " ";
-    std::cout << "Runtime: " << runtime_version << " ";
-    std::cout << "Device: " << props.name;
-    std::cout << std::endl << std::endl;
+    reporter.begin(version, runtime_version, props.name);
 
     for (auto engine : engines)
     {
-        std::cout << engine << ":" << std::endl;
+        reporter.engine(engine);
         for (auto distribution : distributions)
         {
-            std::cout << "  " << distribution << ":" << std::endl;
+            reporter.distribution(distribution);
             const std::string plot_name = engine + "-" + distribution;
             if (engine == "xorwow")
             {
-                run_benchmarks<rocrand_state_xorwow>(parser, distribution);
+                run_benchmarks<rocrand_state_xorwow>(parser, reporter, distribution);
             }
             else if (engine == "mrg32k3a")
             {
-                run_benchmarks<rocrand_state_mrg32k3a>(parser, distribution);
+                run_benchmarks<rocrand_state_mrg32k3a>(parser, reporter, distribution);
             }
             else if (engine == "philox")
             {
-                run_benchmarks<rocrand_state_philox4x32_10>(parser, distribution);
+                run_benchmarks<rocrand_state_philox4x32_10>(parser, reporter, distribution);
             }
             else if (engine == "sobol32")
             {
-                run_benchmarks<rocrand_state_sobol32>(parser, distribution);
+                run_benchmarks<rocrand_state_sobol32>(parser, reporter, distribution);
             }
             else if (engine == "mtgp32")
             {
-                run_benchmarks<rocrand_state_mtgp32>(parser, distribution);
+                run_benchmarks<rocrand_state_mtgp32>(parser, reporter, distribution);
             }
         }
     }
+    reporter.end();
 
     return 0;
 }
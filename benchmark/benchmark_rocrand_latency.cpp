@@ -0,0 +1,415 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+// Parses a size: a number with an optional suffix K, M or G (powers of 1024)
+bool parse_size(const std::string& text, size_t& size)
+{
+    size_t pos = 0;
+    try
+    {
+        size = std::stoull(text, &pos);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    const std::string suffix = text.substr(pos);
+    if (suffix == "K" || suffix == "k")
+        size <<= 10;
+    else if (suffix == "M" || suffix == "m")
+        size <<= 20;
+    else if (suffix == "G" || suffix == "g")
+        size <<= 30;
+    else if (!suffix.empty())
+        return false;
+    return size > 0;
+}
+
+// Parses a geometric range of sizes: <min>..<max>[:<factor>], e.g. 1K..1G or 1K..1G:4
+bool parse_sizes(const std::string& text, size_t& min_size, size_t& max_size, size_t& factor)
+{
+    const size_t range_pos = text.find("..");
+    if (range_pos == std::string::npos)
+        return false;
+    const size_t factor_pos = text.find(':', range_pos);
+    factor = 2;
+    if (factor_pos != std::string::npos
+        && (!parse_size(text.substr(factor_pos + 1), factor) || factor < 2))
+        return false;
+    return parse_size(text.substr(0, range_pos), min_size)
+        && parse_size(text.substr(range_pos + 2, factor_pos - range_pos - 2), max_size)
+        && min_size <= max_size;
+}
+
+// Measures latency of the first generate call of a new generator (which
+// includes initialization of its state), latency of generate calls (each call
+// is followed by synchronization) and average time of back-to-back calls
+// (synchronization after all trials, so only the per-call cost of launching
+// and of loading/saving engines is left) for sizes from --sizes.
+//
+// The crossover is the smallest size whose latency is at least twice the
+// latency of the smallest size: calls of smaller sizes are bound by fixed
+// per-call costs, larger calls are bound by the amount of work.
+template<typename T>
+void run_benchmark(const cli::Parser& parser,
+                   const rng_type_t rng_type,
+                   generate_func_type<T> generate_func)
+{
+    size_t min_size, max_size, factor;
+    parse_sizes(parser.get<std::string>("sizes"), min_size, max_size, factor);
+    const size_t trials = parser.get<size_t>("trials");
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, max_size * sizeof(T)));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    // The first call initializes the generator (e.g. allocates and fills
+    // tables, runs init_engines_kernel)
+    HIP_CHECK(hipStreamSynchronize(stream));
+    auto first_start = std::chrono::high_resolution_clock::now();
+    ROCRAND_CHECK(generate_func(generator, data, min_size));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    auto first_end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::micro> first_elapsed = first_end - first_start;
+    std::cout << std::fixed << std::setprecision(3)
+              << "      "
+              << "First call (size = " << min_size << ") = "
+              << std::setw(10) << first_elapsed.count()
+              << " us"
+              << std::endl;
+
+    double min_size_latency = 0.0;
+    size_t crossover = 0;
+    for (size_t size = min_size; size <= max_size; size *= factor)
+    {
+        // Warm-up
+        for (size_t i = 0; i < 5; i++)
+        {
+            ROCRAND_CHECK(generate_func(generator, data, size));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        // Measurement
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < trials; i++)
+        {
+            ROCRAND_CHECK(generate_func(generator, data, size));
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::micro> elapsed = end - start;
+
+        start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < trials; i++)
+        {
+            ROCRAND_CHECK(generate_func(generator, data, size));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+        end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::micro> elapsed_back_to_back = end - start;
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << "      "
+                  << "Size = "
+                  << std::setw(10) << size
+                  << ", Latency = "
+                  << std::setw(10) << elapsed.count() / trials
+                  << " us, Back-to-back = "
+                  << std::setw(10) << elapsed_back_to_back.count() / trials
+                  << " us, Samples = "
+                  << std::setw(8) << (trials * size) /
+                        (elapsed.count() / 1e6 * (1 << 30))
+                  << " GSample/s"
+                  << std::endl;
+
+        const double latency = elapsed.count() / trials;
+        if (size == min_size)
+            min_size_latency = latency;
+        else if (crossover == 0 && latency >= 2 * min_size_latency)
+            crossover = size;
+
+        if (size > max_size / factor)
+            break;
+    }
+
+    std::cout << "      "
+              << "Crossover ";
+    if (crossover != 0)
+        std::cout << "= " << crossover;
+    else
+        std::cout << "> " << max_size;
+    std::cout << " (latency is twice the latency of size " << min_size << ")"
+              << std::endl;
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+void run_benchmarks(const cli::Parser& parser,
+                    const rng_type_t rng_type,
+                    const std::string& distribution)
+{
+    if (distribution == "uniform-uint")
+    {
+        run_benchmark<unsigned int>(parser, rng_type,
+            [](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-float")
+    {
+        run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_uniform(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-double")
+    {
+        run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_uniform_double(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "normal-float")
+    {
+        run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "normal-double")
+    {
+        run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
+            }
+        );
+    }
+    if (distribution == "log-normal-float")
+    {
+        run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "log-normal-double")
+    {
+        run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
+            }
+        );
+    }
+    if (distribution == "poisson")
+    {
+        const double lambda = parser.get<double>("lambda");
+        run_benchmark<unsigned int>(parser, rng_type,
+            [lambda](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate_poisson(gen, data, size, lambda);
+            }
+        );
+    }
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "sobol32",
+};
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-float",
+    "uniform-double",
+    "normal-float",
+    "normal-double",
+    "log-normal-float",
+    "log-normal-double",
+    "poisson"
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string distribution_desc =
+        "space-separated list of distributions:" +
+        std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<std::string>("sizes", "sizes", "2..16M", "geometric range of numbers of values: <min>..<max>[:<factor>] (suffixes K, M, G)");
+    parser.set_optional<size_t>("trials", "trials", 100, "number of trials for each size");
+    parser.set_optional<double>("lambda", "lambda", 10.0, "lambda of Poisson distribution");
+    parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-float"}, distribution_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    {
+        size_t min_size, max_size, factor;
+        if (!parse_sizes(parser.get<std::string>("sizes"), min_size, max_size, factor))
+        {
+            std::cout << "Wrong sizes" << std::endl;
+            exit(1);
+        }
+    }
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    std::vector<std::string> distributions;
+    {
+        auto ds = parser.get<std::vector<std::string>>("dis");
+        if (std::find(ds.begin(), ds.end(), "all") != ds.end())
+        {
+            distributions = all_distributions;
+        }
+        else
+        {
+            for (auto d : all_distributions)
+            {
+                if (std::find(ds.begin(), ds.end(), d) != ds.end())
+                    distributions.push_back(d);
+            }
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto engine : engines)
+    {
+        rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        if (engine == "xorwow")
+            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        else if (engine == "mrg32k3a")
+            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+        else if (engine == "philox")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "sobol32")
+            rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+        else if (engine == "mtgp32")
+            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+        else
+        {
+            std::cout << "Wrong engine name" << std::endl;
+            exit(1);
+        }
+
+        std::cout << engine << ":" << std::endl;
+
+        for (auto distribution : distributions)
+        {
+            std::cout << "  " << distribution << ":" << std::endl;
+            run_benchmarks(parser, rng_type, distribution);
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
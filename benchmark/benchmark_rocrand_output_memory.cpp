@@ -0,0 +1,348 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+// Ways to deliver generated values to the host
+const std::vector<std::string> all_paths = {
+    "device-copy",
+    "device-copy-pinned",
+    "pinned",
+    "managed"
+};
+
+// Generates size values which are readable on the host using the given path,
+// every trial includes generation, transfer (if any) and reading of
+// the values on the host
+template<typename T>
+void run_path(const cli::Parser& parser,
+              rocrand_generator generator,
+              generate_func_type<T> generate_func,
+              const std::string& path)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+
+    T * device_data = NULL;
+    T * host_data = NULL;
+    std::vector<T> pageable_data;
+    if(path == "device-copy")
+    {
+        HIP_CHECK(hipMalloc((void **)&device_data, size * sizeof(T)));
+        pageable_data.resize(size);
+        host_data = pageable_data.data();
+    }
+    else if(path == "device-copy-pinned")
+    {
+        HIP_CHECK(hipMalloc((void **)&device_data, size * sizeof(T)));
+        HIP_CHECK(hipHostMalloc((void **)&host_data, size * sizeof(T)));
+    }
+    else if(path == "pinned")
+    {
+        HIP_CHECK(hipHostMalloc((void **)&host_data, size * sizeof(T)));
+        device_data = host_data;
+    }
+    else if(path == "managed")
+    {
+        HIP_CHECK(hipMallocManaged((void **)&host_data, size * sizeof(T)));
+        device_data = host_data;
+    }
+
+    // Prevents removal of the host loop
+    volatile T result;
+    auto run = [&]()
+    {
+        ROCRAND_CHECK(generate_func(generator, device_data, size));
+        if(device_data != host_data)
+        {
+            HIP_CHECK(hipMemcpy(host_data, device_data, size * sizeof(T), hipMemcpyDeviceToHost));
+        }
+        else
+        {
+            HIP_CHECK(hipDeviceSynchronize());
+        }
+        // Consume values on the host, so page migration of managed memory is included
+        T sum = 0;
+        for(size_t i = 0; i < size; i++)
+        {
+            sum += host_data[i];
+        }
+        result = sum;
+    };
+
+    // Warm-up
+    for(size_t i = 0; i < 5; i++)
+    {
+        run();
+    }
+
+    // Measurement
+    auto start = std::chrono::high_resolution_clock::now();
+    for(size_t i = 0; i < trials; i++)
+    {
+        run();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "      "
+              << std::setw(20) << std::left << path << std::right
+              << "Time = "
+              << std::setw(10) << elapsed.count() / trials
+              << " ms, Throughput = "
+              << std::setw(8) << (trials * size * sizeof(T)) /
+                    (elapsed.count() / 1e3 * (1 << 30))
+              << " GB/s"
+              << std::endl;
+
+    if(path == "device-copy")
+    {
+        HIP_CHECK(hipFree(device_data));
+    }
+    else if(path == "device-copy-pinned")
+    {
+        HIP_CHECK(hipFree(device_data));
+        HIP_CHECK(hipHostFree(host_data));
+    }
+    else if(path == "pinned")
+    {
+        HIP_CHECK(hipHostFree(host_data));
+    }
+    else if(path == "managed")
+    {
+        HIP_CHECK(hipFree(host_data));
+    }
+}
+
+template<typename T>
+void run_benchmark(const cli::Parser& parser,
+                   const rng_type_t rng_type,
+                   generate_func_type<T> generate_func,
+                   const std::vector<std::string>& paths)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    // Initialization of the generator is not included in measurements
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+
+    for(auto path : paths)
+    {
+        run_path<T>(parser, generator, generate_func, path);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+void run_benchmarks(const cli::Parser& parser,
+                    const rng_type_t rng_type,
+                    const std::string& distribution,
+                    const std::vector<std::string>& paths)
+{
+    if (distribution == "uniform-uint")
+    {
+        run_benchmark<unsigned int>(parser, rng_type,
+            [](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate(gen, data, size);
+            }, paths
+        );
+    }
+    if (distribution == "uniform-float")
+    {
+        run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_uniform(gen, data, size);
+            }, paths
+        );
+    }
+    if (distribution == "uniform-double")
+    {
+        run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_uniform_double(gen, data, size);
+            }, paths
+        );
+    }
+    if (distribution == "normal-float")
+    {
+        run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+            }, paths
+        );
+    }
+    if (distribution == "normal-double")
+    {
+        run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
+            }, paths
+        );
+    }
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "sobol32",
+};
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-float",
+    "uniform-double",
+    "normal-float",
+    "normal-double"
+};
+
+std::vector<std::string> select(const std::vector<std::string>& all,
+                                const std::vector<std::string>& requested)
+{
+    if (std::find(requested.begin(), requested.end(), "all") != requested.end())
+    {
+        return all;
+    }
+    std::vector<std::string> selected;
+    for (auto a : all)
+    {
+        if (std::find(requested.begin(), requested.end(), a) != requested.end())
+            selected.push_back(a);
+    }
+    return selected;
+}
+
+std::string list_desc(const std::string& desc, const std::vector<std::string>& all)
+{
+    return desc +
+        std::accumulate(all.begin(), all.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string distribution_desc =
+        list_desc("space-separated list of distributions:", all_distributions);
+    const std::string engine_desc =
+        list_desc("space-separated list of random number engines:", all_engines);
+    const std::string path_desc =
+        list_desc("space-separated list of ways to deliver values to host:", all_paths);
+
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 16, "number of values");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-float"}, distribution_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("path", "path", {"all"}, path_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    const std::vector<std::string> engines =
+        select(all_engines, parser.get<std::vector<std::string>>("engine"));
+    const std::vector<std::string> distributions =
+        select(all_distributions, parser.get<std::vector<std::string>>("dis"));
+    const std::vector<std::string> paths =
+        select(all_paths, parser.get<std::vector<std::string>>("path"));
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto engine : engines)
+    {
+        rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        if (engine == "xorwow")
+            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        else if (engine == "mrg32k3a")
+            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+        else if (engine == "philox")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "sobol32")
+            rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+        else if (engine == "mtgp32")
+            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+        else
+        {
+            std::cout << "Wrong engine name" << std::endl;
+            exit(1);
+        }
+
+        std::cout << engine << ":" << std::endl;
+
+        for (auto distribution : distributions)
+        {
+            std::cout << "  " << distribution << ":" << std::endl;
+            run_benchmarks(parser, rng_type, distribution, paths);
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,276 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+typedef std::chrono::duration<double, std::micro> duration_us;
+
+void print_time(const std::string& name, const std::vector<double>& times)
+{
+    std::vector<double> sorted_times = times;
+    std::sort(sorted_times.begin(), sorted_times.end());
+    const double mean =
+        std::accumulate(sorted_times.begin(), sorted_times.end(), 0.0) / sorted_times.size();
+    std::cout << std::fixed << std::setprecision(3)
+              << "    "
+              << std::left << std::setw(36) << name << std::right
+              << "Mean = "
+              << std::setw(12) << mean
+              << " us, Median = "
+              << std::setw(12) << sorted_times[sorted_times.size() / 2]
+              << " us, Min = "
+              << std::setw(12) << sorted_times.front()
+              << " us"
+              << std::endl;
+}
+
+// Time of a generate call which initializes the generator (including synchronization)
+double first_generate_time(rocrand_generator generator, unsigned int * data, size_t size)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    auto end = std::chrono::high_resolution_clock::now();
+    return duration_us(end - start).count();
+}
+
+// Measures costs of the life cycle of a generator:
+// * rocrand_create_generator (allocation of engines, host state of MTGP32,
+//   upload of Sobol direction vectors),
+// * the first generate call (init(): init_engines_kernel, table construction),
+// * a generate call of an initialized generator (for comparison),
+// * rocrand_set_seed and the following generate call,
+// * rocrand_set_offset and the following generate call for offsets
+//   2^0, 2^step, 2^(2 * step), ... (skipahead distance of engines),
+// * rocrand_destroy_generator.
+void run_benchmark(const cli::Parser& parser, const rng_type_t rng_type)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+    const unsigned int offset_step = std::max(parser.get<unsigned int>("offset-step"), 1u);
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    // Warm-up (the first generator of a process loads kernels and creates contexts)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        first_generate_time(generator, data, size);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    std::vector<double> create_times;
+    std::vector<double> first_generate_times;
+    std::vector<double> generate_times;
+    std::vector<double> destroy_times;
+    for (size_t i = 0; i < trials; i++)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        rocrand_generator generator;
+        auto start = std::chrono::high_resolution_clock::now();
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        HIP_CHECK(hipDeviceSynchronize());
+        auto end = std::chrono::high_resolution_clock::now();
+        create_times.push_back(duration_us(end - start).count());
+
+        first_generate_times.push_back(first_generate_time(generator, data, size));
+        generate_times.push_back(first_generate_time(generator, data, size));
+
+        start = std::chrono::high_resolution_clock::now();
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        HIP_CHECK(hipDeviceSynchronize());
+        end = std::chrono::high_resolution_clock::now();
+        destroy_times.push_back(duration_us(end - start).count());
+    }
+    print_time("Create", create_times);
+    print_time("First generate (init)", first_generate_times);
+    print_time("Generate (initialized)", generate_times);
+    print_time("Destroy", destroy_times);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    first_generate_time(generator, data, size);
+
+    // Seeding
+    {
+        std::vector<double> seed_times;
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        for (size_t i = 0; i < trials && status == ROCRAND_STATUS_SUCCESS; i++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            status = rocrand_set_seed(generator, 1234ULL + i);
+            auto end = std::chrono::high_resolution_clock::now();
+            if (status == ROCRAND_STATUS_SUCCESS)
+                seed_times.push_back(duration_us(end - start).count() + first_generate_time(generator, data, size));
+        }
+        if (status == ROCRAND_STATUS_TYPE_ERROR)
+            std::cout << "    " << "Set seed: not supported" << std::endl;
+        else
+        {
+            ROCRAND_CHECK(status);
+            print_time("Set seed + generate", seed_times);
+        }
+    }
+
+    // Offsets (skipahead of engines during initialization)
+    for (unsigned int log2_offset = 0; log2_offset < 64; log2_offset += offset_step)
+    {
+        const unsigned long long offset = 1ULL << log2_offset;
+        std::vector<double> offset_times;
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        for (size_t i = 0; i < trials && status == ROCRAND_STATUS_SUCCESS; i++)
+        {
+            // rocrand_set_offset resets the state, so each trial reinitializes engines
+            auto start = std::chrono::high_resolution_clock::now();
+            status = rocrand_set_offset(generator, offset);
+            auto end = std::chrono::high_resolution_clock::now();
+            if (status == ROCRAND_STATUS_SUCCESS)
+                offset_times.push_back(duration_us(end - start).count() + first_generate_time(generator, data, size));
+        }
+        if (status == ROCRAND_STATUS_TYPE_ERROR)
+        {
+            std::cout << "    " << "Set offset: not supported" << std::endl;
+            break;
+        }
+        ROCRAND_CHECK(status);
+        print_time("Set offset 2^" + std::to_string(log2_offset) + " + generate", offset_times);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "sobol32",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", 1024, "number of values generated after creation, seeding and offsetting");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<unsigned int>("offset-step", "offset-step", 8, "offsets are 2^0, 2^step, 2^(2 * step), ... less than 2^64");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto engine : engines)
+    {
+        rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        if (engine == "xorwow")
+            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        else if (engine == "mrg32k3a")
+            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+        else if (engine == "philox")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "sobol32")
+            rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+        else if (engine == "mtgp32")
+            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+        else
+        {
+            std::cout << "Wrong engine name" << std::endl;
+            exit(1);
+        }
+
+        std::cout << engine << ":" << std::endl;
+        run_benchmark(parser, rng_type);
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
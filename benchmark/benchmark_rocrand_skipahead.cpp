@@ -0,0 +1,309 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+
+// Skipahead functions are measured on the host and on the device
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+// Skipahead functions of the device API: skip distance * 2^log2_unit numbers
+struct skipahead_offset
+{
+    static const char * name() { return "skipahead"; }
+
+    template<typename State>
+    static FQUALIFIERS void skip(unsigned long long distance, State * state)
+    {
+        skipahead(distance, state);
+    }
+};
+
+struct skipahead_subsequence_op
+{
+    static const char * name() { return "skipahead_subsequence"; }
+
+    template<typename State>
+    static FQUALIFIERS void skip(unsigned long long distance, State * state)
+    {
+        skipahead_subsequence(distance, state);
+    }
+};
+
+struct skipahead_sequence_op
+{
+    static const char * name() { return "skipahead_sequence"; }
+
+    template<typename State>
+    static FQUALIFIERS void skip(unsigned long long distance, State * state)
+    {
+        skipahead_sequence(distance, state);
+    }
+};
+
+template<typename State>
+__global__
+void init_kernel(State * states, const unsigned long long seed)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    State state;
+    rocrand_init(seed, state_id, 0, &state);
+    states[state_id] = state;
+}
+
+template<typename State, typename Skip>
+__global__
+void skipahead_kernel(State * states, const unsigned long long distance, const unsigned int repeats)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    State state = states[state_id];
+    for (unsigned int i = 0; i < repeats; i++)
+    {
+        Skip::skip(distance, &state);
+    }
+    states[state_id] = state;
+}
+
+// Prevents the compiler from removing skipahead on the host
+volatile unsigned int benchmark_sink;
+
+// Average time (in ns) of one skip of a state on the host
+template<typename State, typename Skip>
+double host_skip_time(const unsigned long long distance, const unsigned int repeats)
+{
+    State state;
+    rocrand_init(12345ULL, 0, 0, &state);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < repeats; i++)
+    {
+        Skip::skip(distance, &state);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::nano> elapsed = end - start;
+
+    benchmark_sink = rocrand(&state);
+    return elapsed.count() / repeats;
+}
+
+// Average time (in ns) of one skip of a state on the device, when all threads
+// skip their own states (i.e. per-thread latency)
+template<typename State, typename Skip>
+double device_skip_time(State * states,
+                        const unsigned int blocks,
+                        const unsigned int threads,
+                        const unsigned long long distance,
+                        const unsigned int repeats)
+{
+    // Warm-up
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(skipahead_kernel<State, Skip>),
+        dim3(blocks), dim3(threads), 0, 0,
+        states, distance, 1
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+    HIP_CHECK(hipEventRecord(start, 0));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(skipahead_kernel<State, Skip>),
+        dim3(blocks), dim3(threads), 0, 0,
+        states, distance, repeats
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipEventRecord(stop, 0));
+    HIP_CHECK(hipEventSynchronize(stop));
+    float elapsed;
+    HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+
+    return elapsed * 1e6 / repeats;
+}
+
+// Measures Skip for distances 2^0, 2^step, ... (in units of 2^log2_unit numbers)
+// while the total distance is not greater than 2^max-log2
+template<typename State, typename Skip>
+void run_benchmark(const cli::Parser& parser, const unsigned int log2_unit)
+{
+    const unsigned int step = std::max(parser.get<unsigned int>("step"), 1u);
+    const unsigned int max_log2 = parser.get<unsigned int>("max-log2");
+    const unsigned int repeats = std::max(parser.get<unsigned int>("repeats"), 1u);
+    const unsigned int blocks = parser.get<unsigned int>("blocks");
+    const unsigned int threads = parser.get<unsigned int>("threads");
+    const std::vector<std::string> backends = parser.get<std::vector<std::string>>("backend");
+    const bool host = std::find(backends.begin(), backends.end(), "host") != backends.end();
+    const bool device = std::find(backends.begin(), backends.end(), "device") != backends.end();
+
+    std::cout << "  " << Skip::name() << ":" << std::endl;
+
+    State * states = NULL;
+    if (device)
+    {
+        HIP_CHECK(hipMalloc((void **)&states, blocks * threads * sizeof(State)));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel<State>),
+            dim3(blocks), dim3(threads), 0, 0,
+            states, 12345ULL
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+    }
+
+    for (unsigned int log2_distance = 0;
+         log2_distance < 64 && log2_distance + log2_unit <= max_log2;
+         log2_distance += step)
+    {
+        const unsigned long long distance = 1ULL << log2_distance;
+        std::cout << std::fixed << std::setprecision(3)
+                  << "      "
+                  << "Distance = 2^"
+                  << std::left << std::setw(4) << log2_distance + log2_unit << std::right;
+        if (host)
+        {
+            std::cout << " Host = "
+                      << std::setw(12) << host_skip_time<State, Skip>(distance, repeats)
+                      << " ns";
+        }
+        if (device)
+        {
+            std::cout << " Device = "
+                      << std::setw(12)
+                      << device_skip_time<State, Skip>(states, blocks, threads, distance, repeats)
+                      << " ns";
+        }
+        std::cout << std::endl;
+    }
+
+    if (device)
+    {
+        HIP_CHECK(hipFree(states));
+    }
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "philox",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<unsigned int>("step", "step", 4, "log2 distances are 0, step, 2 * step, ...");
+    parser.set_optional<unsigned int>("max-log2", "max-log2", 127, "maximal log2 of the distance in numbers");
+    parser.set_optional<unsigned int>("repeats", "repeats", 100, "number of skips of each state");
+    parser.set_optional<unsigned int>("blocks", "blocks", 64, "number of blocks (device)");
+    parser.set_optional<unsigned int>("threads", "threads", 256, "number of threads in each block (device)");
+    parser.set_optional<std::vector<std::string>>("backend", "backend", {"host", "device"}, "space-separated list of backends: host, device");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    const std::vector<std::string> backends = parser.get<std::vector<std::string>>("backend");
+    if (std::find(backends.begin(), backends.end(), "device") != backends.end())
+    {
+        int runtime_version;
+        HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+        int device_id;
+        HIP_CHECK(hipGetDevice(&device_id));
+        hipDeviceProp_t props;
+        HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+        std::cout << "Runtime: " << runtime_version << " ";
+        std::cout << "Device: " << props.name;
+        std::cout << std::endl << std::endl;
+    }
+
+    // Distances are in numbers: a subsequence of XORWOW and MRG32k3a
+    // is 2^67 numbers, of Philox 4 * 2^64 numbers, a sequence of
+    // MRG32k3a is 2^127 numbers
+    for (auto engine : engines)
+    {
+        std::cout << engine << ":" << std::endl;
+        if (engine == "xorwow")
+        {
+            run_benchmark<rocrand_state_xorwow, skipahead_offset>(parser, 0);
+            run_benchmark<rocrand_state_xorwow, skipahead_subsequence_op>(parser, 67);
+        }
+        else if (engine == "mrg32k3a")
+        {
+            run_benchmark<rocrand_state_mrg32k3a, skipahead_offset>(parser, 0);
+            run_benchmark<rocrand_state_mrg32k3a, skipahead_subsequence_op>(parser, 67);
+            run_benchmark<rocrand_state_mrg32k3a, skipahead_sequence_op>(parser, 127);
+        }
+        else if (engine == "philox")
+        {
+            run_benchmark<rocrand_state_philox4x32_10, skipahead_offset>(parser, 0);
+            run_benchmark<rocrand_state_philox4x32_10, skipahead_subsequence_op>(parser, 66);
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,446 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+// Must match the name of the environment variable used by the library
+#define ROCRAND_TUNING_FILE_ENV "ROCRAND_TUNING_FILE"
+
+#ifndef DEFAULT_RAND_N
+const size_t DEFAULT_RAND_N = 1024 * 1024 * 32;
+#endif
+
+typedef rocrand_rng_type rng_type_t;
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+struct config_type
+{
+    unsigned int threads;
+    unsigned int blocks;
+};
+
+// Constraints of launch parameters of engines
+// (must match limits of generators in the library, invalid entries are ignored)
+struct engine_type
+{
+    std::string name;
+    rng_type_t rng_type;
+    unsigned int max_threads;
+    unsigned int threads_multiple;
+    unsigned int max_blocks;
+    unsigned int blocks_multiple;
+};
+
+const std::vector<engine_type> all_engines = {
+    { "xorwow", ROCRAND_RNG_PSEUDO_XORWOW, 1024, 32, 65535, 1 },
+    { "mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A, 1024, 32, 65535, 1 },
+    { "mtgp32", ROCRAND_RNG_PSEUDO_MTGP32, 256, 256, 512, 1 },
+    { "philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 1024, 32, 65535, 16 },
+    { "sobol32", ROCRAND_RNG_QUASI_SOBOL32, 1024, 32, 65535, 1 },
+};
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-float",
+    "uniform-double",
+    "normal-float",
+    "normal-double",
+    "log-normal-float",
+    "log-normal-double",
+    "poisson"
+};
+
+// Writes the tuning file with one entry and makes generators use it
+void set_config(const std::string& path,
+                const std::string& engine,
+                const std::string& device_name,
+                const config_type& config)
+{
+    std::ofstream file(path.c_str());
+    file << engine << " " << config.threads << " " << config.blocks << " " << device_name << std::endl;
+    file.close();
+    setenv(ROCRAND_TUNING_FILE_ENV, path.c_str(), 1);
+}
+
+// Returns throughput (GSample/s)
+template<typename T>
+double run_benchmark(const cli::Parser& parser,
+                     const rng_type_t rng_type,
+                     generate_func_type<T> generate_func)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    // The generator reads the tuning file when it is created
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    // Warm-up
+    for (size_t i = 0; i < 5; i++)
+    {
+        ROCRAND_CHECK(generate_func(generator, data, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Measurement
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < trials; i++)
+    {
+        ROCRAND_CHECK(generate_func(generator, data, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    return (trials * size) / (elapsed.count() / 1e3 * (1 << 30));
+}
+
+double run_benchmarks(const cli::Parser& parser,
+                      const rng_type_t rng_type,
+                      const std::string& distribution)
+{
+    if (distribution == "uniform-uint")
+    {
+        return run_benchmark<unsigned int>(parser, rng_type,
+            [](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-float")
+    {
+        return run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_uniform(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-double")
+    {
+        return run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_uniform_double(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "normal-float")
+    {
+        return run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "normal-double")
+    {
+        return run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
+            }
+        );
+    }
+    if (distribution == "log-normal-float")
+    {
+        return run_benchmark<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "log-normal-double")
+    {
+        return run_benchmark<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
+            }
+        );
+    }
+    if (distribution == "poisson")
+    {
+        return run_benchmark<unsigned int>(parser, rng_type,
+            [](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate_poisson(gen, data, size, 10.0);
+            }
+        );
+    }
+    return 0.0;
+}
+
+// Replaces entries of engine and device_name in the tuning file (other entries
+// are preserved)
+void save_config(const std::string& path,
+                 const std::string& engine,
+                 const std::string& device_name,
+                 const config_type& config)
+{
+    std::vector<std::string> lines;
+    {
+        std::ifstream file(path.c_str());
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream entry(line);
+            std::string entry_engine;
+            unsigned int threads, blocks;
+            std::string entry_device_name;
+            if (line.empty() || line[0] == '#' || !(entry >> entry_engine >> threads >> blocks))
+            {
+                lines.push_back(line);
+                continue;
+            }
+            std::getline(entry >> std::ws, entry_device_name);
+            if (entry_engine != engine || entry_device_name != device_name)
+            {
+                lines.push_back(line);
+            }
+        }
+    }
+    if (lines.empty())
+    {
+        lines.push_back("# rocRAND tuning file: <engine> <threads per block> <blocks> <device name>");
+    }
+    std::ostringstream entry;
+    entry << engine << " " << config.threads << " " << config.blocks << " " << device_name;
+    lines.push_back(entry.str());
+
+    std::ofstream file(path.c_str());
+    for (const std::string& line : lines)
+    {
+        file << line << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string distribution_desc =
+        "space-separated list of distributions used for tuning:" +
+        std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, engine_type b) {
+                return a + "\n      " + b.name;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", DEFAULT_RAND_N, "number of values");
+    parser.set_optional<size_t>("trials", "trials", 10, "number of trials");
+    parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint", "uniform-float", "normal-float"}, distribution_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.set_optional<std::vector<unsigned int>>("threads", "threads", {64, 128, 256, 512, 1024}, "space-separated list of numbers of threads per block");
+    parser.set_optional<std::vector<unsigned int>>("blocks-per-cu", "blocks-per-cu", {1, 2, 4, 8, 16, 32}, "space-separated list of numbers of blocks per compute unit");
+    parser.set_optional<std::string>("output", "output", "rocrand_tuning.txt", "tuning file to save results (entries of other engines and devices are preserved)");
+    parser.run_and_exit_if_error();
+
+    std::vector<engine_type> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        for (auto e : all_engines)
+        {
+            if (std::find(es.begin(), es.end(), "all") != es.end() ||
+                std::find(es.begin(), es.end(), e.name) != es.end())
+                engines.push_back(e);
+        }
+    }
+
+    std::vector<std::string> distributions;
+    {
+        auto ds = parser.get<std::vector<std::string>>("dis");
+        if (std::find(ds.begin(), ds.end(), "all") != ds.end())
+        {
+            distributions = all_distributions;
+        }
+        else
+        {
+            for (auto d : all_distributions)
+            {
+                if (std::find(ds.begin(), ds.end(), d) != ds.end())
+                    distributions.push_back(d);
+            }
+        }
+    }
+
+    const std::string output = parser.get<std::string>("output");
+    const std::string temp_path = output + ".tmp";
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+    const std::string device_name = props.name;
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << device_name << " ";
+    std::cout << "CUs: " << props.multiProcessorCount;
+    std::cout << std::endl << std::endl;
+
+    for (const engine_type& engine : engines)
+    {
+        // Candidate launch parameters valid for the engine
+        std::vector<config_type> configs;
+        for (unsigned int threads : parser.get<std::vector<unsigned int>>("threads"))
+        {
+            if (threads == 0 || threads > engine.max_threads || threads % engine.threads_multiple != 0)
+                continue;
+            for (unsigned int blocks_per_cu : parser.get<std::vector<unsigned int>>("blocks-per-cu"))
+            {
+                unsigned int blocks = blocks_per_cu * props.multiProcessorCount;
+                // Round up to the nearest valid number of blocks
+                blocks = (blocks + engine.blocks_multiple - 1) / engine.blocks_multiple * engine.blocks_multiple;
+                if (blocks == 0 || blocks > engine.max_blocks)
+                    continue;
+                const bool exists = std::find_if(configs.begin(), configs.end(),
+                    [threads, blocks](const config_type& c) {
+                        return c.threads == threads && c.blocks == blocks;
+                    }) != configs.end();
+                if (!exists)
+                    configs.push_back({ threads, blocks });
+            }
+        }
+        if (configs.empty())
+        {
+            std::cout << engine.name << ": no valid launch parameters" << std::endl << std::endl;
+            continue;
+        }
+
+        std::cout << engine.name << ":" << std::endl;
+
+        // throughputs[c][d] is throughput of config c and distribution d
+        std::vector<std::vector<double>> throughputs(configs.size());
+        for (size_t c = 0; c < configs.size(); c++)
+        {
+            set_config(temp_path, engine.name, device_name, configs[c]);
+            std::cout << "  threads " << std::setw(4) << configs[c].threads
+                      << ", blocks " << std::setw(6) << configs[c].blocks << ":";
+            for (const std::string& distribution : distributions)
+            {
+                const double throughput = run_benchmarks(parser, engine.rng_type, distribution);
+                throughputs[c].push_back(throughput);
+                std::cout << " " << std::fixed << std::setprecision(3) << std::setw(8) << throughput;
+            }
+            std::cout << " GSample/s" << std::endl;
+        }
+        unsetenv(ROCRAND_TUNING_FILE_ENV);
+        std::remove(temp_path.c_str());
+
+        // Best parameters for each distribution
+        std::vector<double> best_throughputs(distributions.size(), 0.0);
+        for (size_t d = 0; d < distributions.size(); d++)
+        {
+            size_t best = 0;
+            for (size_t c = 0; c < configs.size(); c++)
+            {
+                if (throughputs[c][d] > throughputs[best][d])
+                    best = c;
+            }
+            best_throughputs[d] = throughputs[best][d];
+            std::cout << "  best for " << distributions[d] << ": threads " << configs[best].threads
+                      << ", blocks " << configs[best].blocks << std::endl;
+        }
+
+        // All distributions of the engine use the same parameters (the number of engine
+        // states depends on them), so select parameters with the best geometric mean
+        // of throughputs relative to the best throughputs of distributions
+        size_t best = 0;
+        double best_score = 0.0;
+        for (size_t c = 0; c < configs.size(); c++)
+        {
+            double score = 0.0;
+            for (size_t d = 0; d < distributions.size(); d++)
+            {
+                score += std::log(throughputs[c][d] / best_throughputs[d]);
+            }
+            score = std::exp(score / distributions.size());
+            if (score > best_score)
+            {
+                best_score = score;
+                best = c;
+            }
+        }
+        std::cout << "  selected: threads " << configs[best].threads
+                  << ", blocks " << configs[best].blocks
+                  << " (" << std::fixed << std::setprecision(1) << best_score * 100.0
+                  << "% of the best throughputs)" << std::endl << std::endl;
+
+        save_config(output, engine.name, device_name, configs[best]);
+    }
+
+    std::cout << "Tuning file: " << output << std::endl;
+    std::cout << "Set " << ROCRAND_TUNING_FILE_ENV << "=" << output
+              << " to use it" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""Compares two result files of rocRAND benchmarks (--format json or csv).
+
+Results are matched by engine, distribution, parameters and size. A result is
+a regression if its throughput is lower than the baseline's by more than
+--threshold percent. The exit status is 1 if there are regressions.
+
+Usage: compare_results.py baseline.json current.json [--threshold 5]
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+
+def load_results(path):
+    with open(path) as f:
+        text = f.read()
+    if text.lstrip().startswith("{"):
+        rows = json.loads(text)["results"]
+    else:
+        rows = list(csv.DictReader(text.splitlines()))
+    results = {}
+    for row in rows:
+        key = (row["engine"], row["distribution"], row["parameters"], int(row["size"]))
+        results[key] = float(row["throughput_gb_s"])
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compares throughput of two rocRAND benchmark result files")
+    parser.add_argument("baseline", help="results of the baseline (json or csv)")
+    parser.add_argument("current", help="results to compare with the baseline (json or csv)")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="slowdown in percent reported as a regression (default: 5)")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    current = load_results(args.current)
+
+    regressions = 0
+    print("{:<10} {:<28} {:<20} {:>10} {:>12} {:>12} {:>9}".format(
+        "engine", "distribution", "parameters", "size", "base GB/s", "curr GB/s", "change"))
+    for key in sorted(baseline):
+        if key not in current:
+            continue
+        engine, distribution, parameters, size = key
+        base = baseline[key]
+        curr = current[key]
+        change = (curr - base) / base * 100.0 if base > 0 else 0.0
+        regression = change < -args.threshold
+        regressions += regression
+        print("{:<10} {:<28} {:<20} {:>10} {:>12.3f} {:>12.3f} {:>+8.2f}%{}".format(
+            engine, distribution, parameters, size, base, curr, change,
+            "  REGRESSION" if regression else ""))
+
+    missing = [key for key in baseline if key not in current]
+    added = [key for key in current if key not in baseline]
+    if missing:
+        print("{} result(s) of the baseline are missing".format(len(missing)))
+    if added:
+        print("{} new result(s) are not in the baseline".format(len(added)))
+    print("{} regression(s) beyond {:.1f}%".format(regressions, args.threshold))
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+# Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""Builds a scoreboard of rocRAND engines: quality against throughput and costs.
+
+For every engine the executables of the build directory are run and their
+results are combined into a single table:
+* tests passed: second level Anderson-Darling tests of stat_test_rocrand_generate
+  (--quality stat) or SmallCrush of crush_test_rocrand (--quality crush),
+* GB/s of benchmark_rocrand_generate for every distribution of --dis,
+* bytes of the state of one thread (benchmark_rocrand_kernel),
+* median times of creation and of the first generate call minus an initialized
+  generate call, i.e. the initialization (benchmark_rocrand_setup).
+
+Values that are not available (the executable is not built, the engine is not
+supported or the run fails) are reported as n/a.
+
+Usage: engine_scoreboard.py --build-dir build [--quality stat|crush|none]
+                            [--engine xorwow philox ...] [--dis uniform-uint ...]
+                            [--format text|csv|markdown]
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+ALL_ENGINES = ["xorwow", "mrg32k3a", "mtgp32", "philox", "sobol32"]
+
+
+def run(build_dir, executable, arguments, timeout):
+    path = os.path.join(build_dir, executable)
+    if not os.path.isfile(path):
+        return None
+    try:
+        result = subprocess.run([path] + arguments, stdout=subprocess.PIPE,
+                                stderr=subprocess.DEVNULL, universal_newlines=True,
+                                timeout=timeout)
+    except subprocess.TimeoutExpired:
+        return None
+    if result.returncode != 0:
+        return None
+    return result.stdout
+
+
+def parse_stat_test(output):
+    """Counts passed second level tests (lines AD, failed p-values end with *)."""
+    passed = 0
+    total = 0
+    for line in output.splitlines():
+        tokens = line.split()
+        if not tokens or tokens[0] != "AD":
+            continue
+        for p in tokens[2::2]:
+            total += 1
+            passed += not p.endswith("*")
+    return (passed, total) if total > 0 else None
+
+
+def parse_crush_test(output):
+    """Counts passed statistics of the summary of a TestU01 battery."""
+    total = None
+    failed = None
+    lines = output.splitlines()
+    for i, line in enumerate(lines):
+        line = line.strip()
+        if line.startswith("Number of statistics:"):
+            total = int(line.split(":")[1])
+        elif line.startswith("All tests were passed"):
+            failed = 0
+        elif line.startswith("The following tests gave p-values outside"):
+            separators = [j for j in range(i, len(lines)) if lines[j].strip().startswith("---")]
+            if len(separators) >= 2:
+                failed = separators[1] - separators[0] - 1
+    if total is None or failed is None:
+        return None
+    return (total - failed, total)
+
+
+def parse_json_results(output, field):
+    try:
+        rows = json.loads(output)["results"]
+    except (ValueError, KeyError):
+        return {}
+    return {row["distribution"]: row[field] for row in rows if field in row}
+
+
+def parse_setup_time(output, name):
+    """Returns the median time (us) of a line of benchmark_rocrand_setup."""
+    for line in output.splitlines():
+        line = line.strip()
+        if line.startswith(name) and "Median =" in line:
+            return float(line.split("Median =")[1].split("us")[0])
+    return None
+
+
+def score_engine(args, engine):
+    score = {"engine": engine}
+
+    score["tests"] = None
+    if args.quality == "stat":
+        output = run(args.build_dir, os.path.join("test", "stat_test_rocrand_generate"),
+                     ["--engine", engine, "--dis"] + args.stat_dis, args.timeout)
+        score["tests"] = parse_stat_test(output) if output else None
+    elif args.quality == "crush":
+        output = run(args.build_dir, os.path.join("test", "crush_test_rocrand"),
+                     ["--engine", engine], args.timeout)
+        score["tests"] = parse_crush_test(output) if output else None
+
+    output = run(args.build_dir, os.path.join("benchmark", "benchmark_rocrand_generate"),
+                 ["--engine", engine, "--dis"] + args.dis +
+                 ["--size", str(args.size), "--trials", str(args.trials), "--format", "json"],
+                 args.timeout)
+    score["throughput"] = parse_json_results(output, "throughput_gb_s") if output else {}
+
+    output = run(args.build_dir, os.path.join("benchmark", "benchmark_rocrand_kernel"),
+                 ["--engine", engine, "--dis", "uniform-uint", "--size", str(args.size),
+                  "--trials", "1", "--warmup", "0", "--format", "json"],
+                 args.timeout)
+    state = parse_json_results(output, "state_bytes") if output else {}
+    score["state_bytes"] = state.get("uniform-uint")
+
+    output = run(args.build_dir, os.path.join("benchmark", "benchmark_rocrand_setup"),
+                 ["--engine", engine, "--trials", str(args.trials)], args.timeout)
+    score["create_us"] = parse_setup_time(output, "Create") if output else None
+    score["init_us"] = None
+    if output:
+        first = parse_setup_time(output, "First generate (init)")
+        initialized = parse_setup_time(output, "Generate (initialized)")
+        if first is not None and initialized is not None:
+            score["init_us"] = max(first - initialized, 0.0)
+    return score
+
+
+def format_row(score, dis):
+    def value(v, precision):
+        return "n/a" if v is None else "{:.{}f}".format(v, precision)
+
+    tests = score["tests"]
+    row = [score["engine"], "n/a" if tests is None else "{}/{}".format(*tests)]
+    row += [value(score["throughput"].get(d), 3) for d in dis]
+    row += ["n/a" if score["state_bytes"] is None else str(score["state_bytes"]),
+            value(score["create_us"], 1), value(score["init_us"], 1)]
+    return row
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Builds a scoreboard of rocRAND engines (tests passed, GB/s, state bytes, init cost)")
+    parser.add_argument("--build-dir", default=".",
+                        help="rocRAND build directory with test/ and benchmark/ (default: .)")
+    parser.add_argument("--engine", nargs="+", default=ALL_ENGINES,
+                        help="engines: all, " + ", ".join(ALL_ENGINES) + " (default: all)")
+    parser.add_argument("--dis", nargs="+", default=["uniform-uint", "uniform-float", "normal-float"],
+                        help="distributions of throughput columns (default: uniform-uint uniform-float normal-float)")
+    parser.add_argument("--quality", choices=["stat", "crush", "none"], default="stat",
+                        help="statistical tests: stat_test_rocrand_generate (stat), SmallCrush "
+                             "of crush_test_rocrand (crush, slow) or none (default: stat)")
+    parser.add_argument("--stat-dis", nargs="+", default=["uniform-float", "normal-float"],
+                        help="distributions tested by stat_test_rocrand_generate "
+                             "(default: uniform-float normal-float)")
+    parser.add_argument("--size", type=int, default=128 * 1024 * 1024,
+                        help="number of values of throughput benchmarks (default: 128M)")
+    parser.add_argument("--trials", type=int, default=20,
+                        help="number of trials of benchmarks (default: 20)")
+    parser.add_argument("--timeout", type=float, default=3600.0,
+                        help="timeout of every run in seconds (default: 3600)")
+    parser.add_argument("--format", choices=["text", "csv", "markdown"], default="text",
+                        help="output format (default: text)")
+    args = parser.parse_args()
+    if "all" in args.engine:
+        args.engine = ALL_ENGINES
+
+    header = ["engine", "tests passed"] + ["{} GB/s".format(d) for d in args.dis] + \
+             ["state bytes", "create us", "init us"]
+    rows = []
+    for engine in args.engine:
+        print("Running {}...".format(engine), file=sys.stderr)
+        rows.append(format_row(score_engine(args, engine), args.dis))
+
+    if args.format == "csv":
+        print(",".join(h.replace(" ", "_").replace("/", "_") for h in header))
+        for row in rows:
+            print(",".join(row))
+    elif args.format == "markdown":
+        print("| " + " | ".join(header) + " |")
+        print("|" + "|".join("---" for _ in header) + "|")
+        for row in rows:
+            print("| " + " | ".join(row) + " |")
+    else:
+        widths = [max(len(r[i]) for r in [header] + rows) for i in range(len(header))]
+        print("  ".join(h.ljust(w) if i == 0 else h.rjust(w)
+                        for i, (h, w) in enumerate(zip(header, widths))))
+        for row in rows:
+            print("  ".join(v.ljust(w) if i == 0 else v.rjust(w)
+                            for i, (v, w) in enumerate(zip(row, widths))))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
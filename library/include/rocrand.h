@@ -38,9 +38,15 @@
 
 #include "rocrand_version.h"
 
+/// Maximum number of dimensions of vectors generated by
+/// rocrand_generate_multivariate_normal()
+#define ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS 32
+
 /// \cond ROCRAND_DOCS_TYPEDEFS
 /// rocRAND random number generator (opaque)
 typedef struct rocrand_generator_base_type * rocrand_generator;
+/// rocRAND host prefetcher (opaque)
+typedef struct rocrand_host_prefetcher_type * rocrand_host_prefetcher;
 /// \endcond
 
 #if defined(__cplusplus)
@@ -78,6 +84,64 @@ typedef enum rocrand_rng_type {
     ROCRAND_RNG_QUASI_SOBOL32 = 501 ///< Sobol32 quasirandom generator
 } rocrand_rng_type;
 
+/**
+ * \brief rocRAND generator ordering
+ *
+ * Ordering defines how generated numbers are mapped to subsequences
+ * (or streams) of the generator and positions in them.
+ */
+typedef enum rocrand_ordering {
+    ROCRAND_ORDERING_PSEUDO_DEFAULT = 100, ///< Default ordering for pseudorandom results,
+                                           ///< results depend on launch parameters of the generator
+                                           ///< (and therefore on the device)
+    ROCRAND_ORDERING_PSEUDO_PORTABLE = 101, ///< Portable ordering for pseudorandom results,
+                                            ///< results do not depend on launch parameters of the generator
+    ROCRAND_ORDERING_QUASI_DEFAULT = 201 ///< Default ordering for quasirandom results
+} rocrand_ordering;
+
+/**
+ * \brief Type of values delivered by a host prefetcher
+ */
+typedef enum rocrand_prefetch_type {
+    ROCRAND_PREFETCH_UINT = 0, ///< 32-bit unsigned integers, see rocrand_generate()
+    ROCRAND_PREFETCH_UNIFORM_FLOAT = 1, ///< Uniform floats, see rocrand_generate_uniform()
+    ROCRAND_PREFETCH_UNIFORM_DOUBLE = 2, ///< Uniform doubles, see rocrand_generate_uniform_double()
+    ROCRAND_PREFETCH_NORMAL_FLOAT = 3, ///< Standard normal floats, see rocrand_generate_normal()
+    ROCRAND_PREFETCH_NORMAL_DOUBLE = 4 ///< Standard normal doubles, see rocrand_generate_normal_double()
+} rocrand_prefetch_type;
+
+/**
+ * \brief Statistics collection mode of a generator
+ */
+typedef enum rocrand_generator_stats_mode {
+    ROCRAND_GENERATOR_STATS_DISABLED = 0, ///< Statistics are not collected (default)
+    ROCRAND_GENERATOR_STATS_COUNTERS = 1, ///< Counters of numbers, calls, kernel launches etc. are collected
+    ROCRAND_GENERATOR_STATS_TIMING = 2 ///< Counters are collected and generate calls are timed with HIP events
+} rocrand_generator_stats_mode;
+
+/**
+ * \brief Statistics of a generator
+ *
+ * See rocrand_set_generator_stats() and rocrand_get_generator_stats().
+ */
+typedef struct rocrand_generator_stats {
+    unsigned long long uniform_numbers; ///< Numbers generated by rocrand_generate() and rocrand_generate_uniform*()
+    unsigned long long normal_numbers; ///< Numbers generated by rocrand_generate_normal*()
+    unsigned long long log_normal_numbers; ///< Numbers generated by rocrand_generate_log_normal*()
+    unsigned long long truncated_normal_numbers; ///< Numbers generated by rocrand_generate_truncated_normal*()
+    unsigned long long multivariate_normal_numbers; ///< Numbers (vectors times dimensions) generated by rocrand_generate_multivariate_normal*()
+    unsigned long long brownian_bridge_numbers; ///< Numbers generated by rocrand_generate_brownian_bridge*()
+    unsigned long long poisson_numbers; ///< Numbers generated by rocrand_generate_poisson()
+    unsigned long long binomial_numbers; ///< Numbers generated by rocrand_generate_binomial()
+    unsigned long long negative_binomial_numbers; ///< Numbers generated by rocrand_generate_negative_binomial()
+    unsigned long long generate_calls; ///< Number of calls of generate functions
+    unsigned long long kernel_launches; ///< Number of kernels launched by the generator
+    unsigned long long initializations; ///< Number of (re)initializations of the generator's state
+    unsigned long long table_builds; ///< Number of (re)computations of distribution tables
+                                     ///< (Poisson, binomial, negative binomial, Brownian bridge)
+    double kernel_time_ms; ///< Total time of generate calls on the generator's stream in milliseconds
+                           ///< (only with ROCRAND_GENERATOR_STATS_TIMING)
+} rocrand_generator_stats;
 
 // Host API function
 
@@ -131,13 +195,28 @@ rocrand_destroy_generator(rocrand_generator generator);
  * Generated numbers are between \p 0 and \p 2^32, including \p 0 and
  * excluding \p 2^32.
  *
+ * This and all other generate functions detect the type of memory referenced
+ * by \p output_data:
+ * - device memory is written directly;
+ * - pinned host memory (allocated by hipHostMalloc() or registered by
+ * hipHostRegister()) is written by kernels through its device mapping, so
+ * results are available on the host after synchronization with the generator's
+ * stream without a device buffer and a copy;
+ * - managed memory (allocated by hipMallocManaged()) is prefetched to the
+ * current device on the generator's stream before generation.
+ *
+ * The type of memory is determined when \p output_data differs from the pointer
+ * of the previous generate call of the generator.
+ *
  * \param generator - Generator to use
  * \param output_data - Pointer to memory to store generated numbers
  * \param n - Number of 32-bit unsigned integers to generate
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed, or
+ * \p output_data is pinned host memory which is not mapped to the device's
+ * address space \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
@@ -294,6 +373,214 @@ rocrand_generate_log_normal_double(rocrand_generator generator,
                                    double * output_data, size_t n,
                                    double mean, double stddev);
 
+/**
+ * \brief Generates truncated normally distributed \p float values.
+ *
+ * Generates \p n 32-bit floating-point values from the normal distribution
+ * with mean \p mean and standard deviation \p stddev restricted to
+ * the interval [\p lower, \p upper], and saves them to \p output_data.
+ *
+ * Values are generated by inversion of the truncated normal CDF, one value
+ * per generated 32-bit random number, so no rejection is involved and
+ * quasi-random generators keep their low-discrepancy properties.
+ * CDF is computed in double precision when both bounds are further than
+ * 12 standard deviations from \p mean on the same side (values of CDF underflow
+ * in single precision).
+ * When both bounds are further than 37 standard deviations, the tail is
+ * approximated by the exponential distribution (see
+ * rocrand_generate_truncated_normal_double()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of the underlying normal distribution
+ * \param stddev - Standard deviation value of the underlying normal distribution
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is non-positive or
+ * \p lower is not less than \p upper \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lower, float upper);
+
+/**
+ * \brief Generates truncated normally distributed \p double values.
+ *
+ * Generates \p n 64-bit double-precision floating-point values from the normal
+ * distribution with mean \p mean and standard deviation \p stddev restricted
+ * to the interval [\p lower, \p upper], and saves them to \p output_data.
+ *
+ * Values are generated by inversion of the truncated normal CDF, one value
+ * per generated 32-bit random number.
+ * Values of CDF underflow in double precision when both bounds are further
+ * than 37 standard deviations from \p mean on the same side, in this case the tail
+ * is approximated by the translated exponential distribution with rate \p d,
+ * where \p d is the distance from \p mean to the closer bound in standard
+ * deviations (the relative error of the density is about 1 / (2 * d^2)).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of the underlying normal distribution
+ * \param stddev - Standard deviation value of the underlying normal distribution
+ * \param lower - Lower bound of the interval
+ * \param upper - Upper bound of the interval
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is non-positive or
+ * \p lower is not less than \p upper \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lower, double upper);
+
+/**
+ * \brief Generates multivariate normally distributed \p float vectors.
+ *
+ * Generates \p n_vectors vectors of \p dimensions 32-bit floating-point values
+ * from the multivariate normal distribution with mean vector \p mean and
+ * covariance matrix <tt>L * L^T</tt>, where \p L is \p cholesky_factor, and saves
+ * them to \p output_data (vector by vector, i.e. <tt>n_vectors * dimensions</tt> values).
+ *
+ * Correlation is applied inside the generation kernel right after Box-Muller
+ * transform, so no intermediate array of independent normal values is written.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to device memory to store generated numbers
+ * \param n_vectors - Number of vectors to generate
+ * \param dimensions - Number of values in each vector, from 1 to
+ * ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS
+ * \param mean - Pointer to device memory with \p dimensions values of mean vector
+ * \param cholesky_factor - Pointer to device memory with <tt>dimensions * dimensions</tt>
+ * values of lower triangular Cholesky factor of covariance matrix (row-major,
+ * values above the diagonal are not used)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 or greater than
+ * ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS, or \p mean or \p cholesky_factor is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data, size_t n_vectors,
+                                     unsigned int dimensions,
+                                     const float * mean,
+                                     const float * cholesky_factor);
+
+/**
+ * \brief Generates multivariate normally distributed \p double vectors.
+ *
+ * Generates \p n_vectors vectors of \p dimensions 64-bit double-precision
+ * floating-point values from the multivariate normal distribution with mean
+ * vector \p mean and covariance matrix <tt>L * L^T</tt>, where \p L is
+ * \p cholesky_factor, and saves them to \p output_data (vector by vector).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to device memory to store generated numbers
+ * \param n_vectors - Number of vectors to generate
+ * \param dimensions - Number of values in each vector, from 1 to
+ * ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS
+ * \param mean - Pointer to device memory with \p dimensions values of mean vector
+ * \param cholesky_factor - Pointer to device memory with <tt>dimensions * dimensions</tt>
+ * values of lower triangular Cholesky factor of covariance matrix (row-major,
+ * values above the diagonal are not used)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is 0 or greater than
+ * ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS, or \p mean or \p cholesky_factor is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal_double(rocrand_generator generator,
+                                            double * output_data, size_t n_vectors,
+                                            unsigned int dimensions,
+                                            const double * mean,
+                                            const double * cholesky_factor);
+
+/**
+ * \brief Generates Brownian motion paths with \p float values.
+ *
+ * Generates <tt>n / dimensions</tt> discretely sampled paths of standard Brownian
+ * motion, where \p dimensions is the number of dimensions of the quasi-random
+ * generator (set by rocrand_set_quasi_random_generator_dimensions()) and is
+ * the number of time steps of each path. Value of step \p t (from 0) of path
+ * \p i is W((t + 1) * time_step) and is saved to
+ * <tt>output_data[t * (n / dimensions) + i]</tt>, i.e. the output has the same
+ * layout as rocrand_generate_normal() for quasi-random generators.
+ *
+ * Paths are built using the Brownian bridge construction: the first dimensions
+ * of the sequence determine the end of paths and the largest-scale structure,
+ * further dimensions fill smaller intervals. The construction is done in the
+ * generation kernel, normal values are not written to memory.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of floats to generate
+ * \param time_step - Length of the time step
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_QUASI_SOBOL32 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed or tables
+ * must be created during stream capture (see rocrand_prepare_brownian_bridge()) \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number of dimensions \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p time_step is not positive \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_bridge(rocrand_generator generator,
+                                 float * output_data, size_t n,
+                                 float time_step);
+
+/**
+ * \brief Generates Brownian motion paths with \p double values.
+ *
+ * Generates <tt>n / dimensions</tt> discretely sampled paths of standard Brownian
+ * motion using the Brownian bridge construction, see
+ * rocrand_generate_brownian_bridge() for details.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of doubles to generate
+ * \param time_step - Length of the time step
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_QUASI_SOBOL32 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed or tables
+ * must be created during stream capture (see rocrand_prepare_brownian_bridge()) \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number of dimensions \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p time_step is not positive \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_bridge_double(rocrand_generator generator,
+                                        double * output_data, size_t n,
+                                        double time_step);
+
 /**
  * \brief Generates Poisson-distributed 32-bit unsigned integers.
  *
@@ -307,7 +594,8 @@ rocrand_generate_log_normal_double(rocrand_generator generator,
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed or tables
+ * must be created during stream capture (see rocrand_prepare_poisson()) \n
  * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
@@ -318,6 +606,66 @@ rocrand_generate_poisson(rocrand_generator generator,
                          unsigned int * output_data, size_t n,
                          double lambda);
 
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers (numbers of
+ * successes in \p trials Bernoulli trials with success probability \p probability)
+ * and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param trials - Number of trials
+ * \param probability - Probability of success in each trial
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed or tables
+ * must be created during stream capture (see rocrand_prepare_binomial()) \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p probability is not in [0, 1] \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int trials, double probability);
+
+/**
+ * \brief Generates negative binomially distributed 32-bit unsigned integers.
+ *
+ * Generates \p n negative binomially distributed 32-bit unsigned integers
+ * (numbers of failures before \p successes successes in Bernoulli trials with
+ * success probability \p probability) and saves them to \p output_data.
+ * \p successes can be non-integer (Polya distribution).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param successes - Number of successes
+ * \param probability - Probability of success in each trial
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed or tables
+ * must be created during stream capture (see rocrand_prepare_negative_binomial()) \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory for tables of the distribution
+ * could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p successes is non-positive,
+ * \p probability is not in (0, 1] or the distribution is too wide for tables
+ * (more than 2^22 values with probabilities of at least 1e-12, for example, when
+ * \p probability is very small) \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_negative_binomial(rocrand_generator generator,
+                                   unsigned int * output_data, size_t n,
+                                   double successes, double probability);
+
 /**
  * \brief Initializes the generator's state on GPU or host.
  *
@@ -328,16 +676,152 @@ rocrand_generate_poisson(rocrand_generator generator,
  * automatically called by functions which generates random numbers like
  * rocrand_generate(), rocrang_generate_uniform() etc.
  *
+ * This function prepares the generator for stream capture (for example,
+ * recording generate calls into a HIP graph): after it, functions which
+ * generate random numbers only launch kernels on the generator's stream,
+ * without memory allocations, copies or synchronization. The exceptions are:
+ * - rocrand_set_seed(), rocrand_set_offset() and rocrand_set_ordering() reset
+ * the generator's state, rocrand_initialize_generator() must be called again
+ * (otherwise the initialization is captured and repeated on each replay);
+ * - rocrand_generate_poisson(), rocrand_generate_binomial(),
+ * rocrand_generate_negative_binomial() and rocrand_generate_brownian_bridge()
+ * create device tables when they are called with new parameters. Tables of all
+ * parameters used during capture must be created before it with
+ * rocrand_prepare_poisson(), rocrand_prepare_binomial(),
+ * rocrand_prepare_negative_binomial() and rocrand_prepare_brownian_bridge(),
+ * then switching between them only changes kernel arguments. If a table must be
+ * created during capture, ROCRAND_STATUS_LAUNCH_FAILURE is returned and
+ * the capture is not affected. Prepared tables are kept until
+ * rocrand_release_prepared_tables() is called or the generator is destroyed.
+ *
+ * The state of pseudorandom generators is stored in device memory, so each
+ * replay of captured calls generates new numbers. The offset of quasirandom
+ * generators is passed to kernels, so replays generate the same numbers.
+ *
  * \param generator - Generator to initialize
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed or MTGP32
+ * states must be created during stream capture \n
  * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
  */
 rocrand_status ROCRANDAPI
 rocrand_initialize_generator(rocrand_generator generator);
 
+/**
+ * \brief Creates tables of Poisson distribution for stream capture.
+ *
+ * Creates device tables of Poisson distribution with mean \p lambda, they are
+ * kept until rocrand_release_prepared_tables() is called or the generator is
+ * destroyed. rocrand_generate_poisson() with
+ * \p lambda does not allocate or copy memory, so it can be captured
+ * (see rocrand_initialize_generator()).
+ *
+ * \param generator - Generator to use
+ * \param lambda - lambda for the Poisson distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if tables were created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prepare_poisson(rocrand_generator generator, double lambda);
+
+/**
+ * \brief Creates tables of binomial distribution for stream capture.
+ *
+ * Creates device tables of binomial distribution with \p trials trials and
+ * success probability \p probability, they are kept until
+ * rocrand_release_prepared_tables() is called or the generator is destroyed.
+ * rocrand_generate_binomial() with these parameters does not
+ * allocate or copy memory, so it can be captured
+ * (see rocrand_initialize_generator()).
+ *
+ * \param generator - Generator to use
+ * \param trials - Number of trials
+ * \param probability - Probability of success in each trial
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p probability is not in [0, 1] \n
+ * - ROCRAND_STATUS_SUCCESS if tables were created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prepare_binomial(rocrand_generator generator,
+                         unsigned int trials, double probability);
+
+/**
+ * \brief Creates tables of negative binomial distribution for stream capture.
+ *
+ * Creates device tables of negative binomial distribution with \p successes
+ * successes and success probability \p probability, they are kept until
+ * rocrand_release_prepared_tables() is called or the generator is destroyed.
+ * rocrand_generate_negative_binomial() with these
+ * parameters does not allocate or copy memory, so it can be captured
+ * (see rocrand_initialize_generator()).
+ *
+ * \param generator - Generator to use
+ * \param successes - Number of successes
+ * \param probability - Probability of success in each trial
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p successes is non-positive,
+ * \p probability is not in (0, 1] or the distribution is too wide for tables
+ * (see rocrand_generate_negative_binomial()) \n
+ * - ROCRAND_STATUS_SUCCESS if tables were created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prepare_negative_binomial(rocrand_generator generator,
+                                  double successes, double probability);
+
+/**
+ * \brief Creates the Brownian bridge matrix for stream capture.
+ *
+ * Creates the Brownian bridge matrix for the current number of dimensions of
+ * the quasi-random generator, it is kept until rocrand_release_prepared_tables()
+ * is called or the generator is destroyed. rocrand_generate_brownian_bridge() with this number of dimensions does not
+ * allocate or copy memory, so it can be captured
+ * (see rocrand_initialize_generator()).
+ *
+ * \param generator - Generator to use
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random
+ * generator \n
+ * - ROCRAND_STATUS_SUCCESS if the matrix was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prepare_brownian_bridge(rocrand_generator generator);
+
+/**
+ * \brief Frees tables created for stream capture.
+ *
+ * Frees all tables and matrices created by rocrand_prepare_poisson(),
+ * rocrand_prepare_binomial(), rocrand_prepare_negative_binomial() and
+ * rocrand_prepare_brownian_bridge(). Graphs captured with these tables must
+ * not be launched after this call. Tables are created again when they are
+ * used or prepared.
+ *
+ * \param generator - Generator to use
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the generator's stream is being
+ * captured \n
+ * - ROCRAND_STATUS_SUCCESS if tables were freed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_release_prepared_tables(rocrand_generator generator);
+
 /**
  * \brief Sets the current stream for kernel launches.
  *
@@ -398,6 +882,94 @@ rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
 rocrand_status ROCRANDAPI
 rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
 
+/**
+ * \brief Sets the ordering of a random number generator.
+ *
+ * Sets the ordering of results of the random number generator.
+ *
+ * With ROCRAND_ORDERING_PSEUDO_DEFAULT (the default for pseudorandom generators),
+ * the group of values with index \p j of a generate call is generated by the
+ * subsequence <tt>j % T</tt>, where \p T is the number of threads of the kernel,
+ * which depends on the device, the size of the request and the tuning file.
+ *
+ * With ROCRAND_ORDERING_PSEUDO_PORTABLE, the mapping of indices to subsequences
+ * is fixed and is independent of launch parameters, so the same seed, offset
+ * and sequence of generate calls give the same results on all devices:
+ * - ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A: number \p i of
+ * uniform and discrete distributions is generated by the subsequence
+ * <tt>i % 131072</tt>, pair of values with index \p j of normal and log-normal
+ * distributions is generated by the subsequence <tt>j % 131072</tt>;
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10: each group of 4 32-bit values with index
+ * \p j is generated by the subsequence <tt>(j % 262144) / 16</tt>;
+ * - ROCRAND_RNG_PSEUDO_MTGP32: number \p i is generated by the generator
+ * <tt>(i / 256) % 512</tt>.
+ *
+ * Quasirandom generators support only ROCRAND_ORDERING_QUASI_DEFAULT,
+ * their results never depend on launch parameters.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed and offset.
+ *
+ * \param generator - Random number generator
+ * \param order - New ordering of results
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p order is not valid for the generator's type \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order);
+
+/**
+ * \brief Sets the statistics collection mode of a generator.
+ *
+ * Statistics are disabled by default, so generators do not pay for them.
+ * With ROCRAND_GENERATOR_STATS_COUNTERS the generator counts generated numbers
+ * per distribution, generate calls, kernel launches, (re)initializations of
+ * its state and (re)computations of distribution tables on the host.
+ * ROCRAND_GENERATOR_STATS_TIMING additionally records HIP events on
+ * the generator's stream before and after each generate call, the elapsed
+ * time is accumulated when the events are reused or statistics are queried,
+ * so generate calls stay asynchronous.
+ *
+ * All statistics are reset to zero by this function.
+ *
+ * \param generator - Generator to modify
+ * \param mode - Statistics collection mode
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p mode is not valid \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if HIP events could not be created \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_generator_stats(rocrand_generator generator,
+                            rocrand_generator_stats_mode mode);
+
+/**
+ * \brief Returns statistics of a generator.
+ *
+ * Returns in \p stats statistics collected since the last call of
+ * rocrand_set_generator_stats(). All values are zero if statistics are
+ * disabled. With ROCRAND_GENERATOR_STATS_TIMING this function waits until
+ * all timed generate calls are completed.
+ *
+ * \param generator - Generator to query
+ * \param stats - Pointer to statistics
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stats is NULL \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if elapsed time of HIP events could not be read \n
+ * - ROCRAND_STATUS_SUCCESS if statistics were successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_generator_stats(rocrand_generator generator,
+                            rocrand_generator_stats * stats);
+
 /**
  * \brief Set the number of dimensions of a quasi-random number generator.
  *
@@ -492,6 +1064,87 @@ rocrand_create_discrete_distribution(const double * probabilities,
 rocrand_status ROCRANDAPI
 rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution);
 
+/**
+ * \brief Creates a host prefetcher for streaming results to host memory.
+ *
+ * Creates a prefetcher which delivers values generated by \p generator
+ * to host memory in buffers of \p n values of type \p type, and returns
+ * it in \p prefetcher.
+ *
+ * The prefetcher owns two buffers in device memory and two buffers in pinned
+ * host memory. While the host reads a buffer returned by
+ * rocrand_host_prefetcher_next(), the next buffer is generated on the
+ * generator's stream and copied to host memory on an internal stream,
+ * so generation and transfer overlap with processing on the host.
+ *
+ * Values are generated by the same generate functions as in direct calls
+ * (rocrand_generate(), rocrand_generate_uniform() etc.), so the concatenation
+ * of returned buffers is equal to results of consecutive generate calls
+ * of size \p n. Since the prefetcher generates one buffer ahead, the generator
+ * must not be used directly or changed (seed, offset, stream etc.) while
+ * the prefetcher exists.
+ *
+ * \param prefetcher - Pointer to host prefetcher
+ * \param generator - Generator to use
+ * \param type - Type of values
+ * \param n - Number of values in each buffer
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p type is invalid \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n is zero \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator, or \p n is odd for normal values
+ *   of a pseudo-random generator which generates them in pairs \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if streams or events could not be created \n
+ * - ROCRAND_STATUS_SUCCESS if the prefetcher was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_host_prefetcher(rocrand_host_prefetcher * prefetcher,
+                               rocrand_generator generator,
+                               rocrand_prefetch_type type,
+                               size_t n);
+
+/**
+ * \brief Returns the next buffer of values in host memory.
+ *
+ * Waits until the next buffer is copied to host memory, returns it in
+ * \p output and starts generation of the following buffer into the buffer
+ * returned by the previous call. Therefore the pointer is valid only until
+ * the next call of rocrand_host_prefetcher_next() or
+ * rocrand_destroy_host_prefetcher().
+ *
+ * \param prefetcher - Host prefetcher
+ * \param output - Pointer to pointer to \p n values in pinned host memory
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the prefetcher wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel launch failed for any reason \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if the generate function does not support
+ *   \p n values of the prefetcher's type (see rocrand_generate_normal()) \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy or synchronization failed \n
+ * - ROCRAND_STATUS_SUCCESS if the buffer was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_host_prefetcher_next(rocrand_host_prefetcher prefetcher,
+                             const void ** output);
+
+/**
+ * \brief Destroys host prefetcher.
+ *
+ * Waits for pending copies and frees memory of the prefetcher.
+ * The generator is not destroyed.
+ *
+ * \param prefetcher - Host prefetcher to be destroyed
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the prefetcher wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the prefetcher was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_host_prefetcher(rocrand_host_prefetcher prefetcher);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -845,6 +845,104 @@ private:
     param_type m_params;
 };
 
+/// \class host_prefetcher
+///
+/// \brief Streams random values from an engine to host memory.
+///
+/// host_prefetcher delivers values generated by a random number engine
+/// in buffers of \p size values in pinned host memory. While the host reads
+/// a buffer returned by next(), the next buffer is generated and copied
+/// to host memory, so generation and transfer overlap with processing
+/// on the host.
+///
+/// \tparam T - type of values: \p unsigned \p int (random integers),
+/// \p float or \p double (uniform or standard normal values).
+///
+/// See also: rocrand_create_host_prefetcher()
+template<class T = unsigned int>
+class host_prefetcher
+{
+    static_assert(
+        std::is_same<unsigned int, T>::value
+        || std::is_same<float, T>::value
+        || std::is_same<double, T>::value,
+        "Only unsigned int, float and double types are supported in host_prefetcher"
+    );
+
+public:
+    /// \typedef value_type
+    /// Type of values delivered by the prefetcher.
+    typedef T value_type;
+
+    /// \brief Constructs the prefetcher.
+    ///
+    /// The engine \p g must outlive the prefetcher and must not be used
+    /// directly while the prefetcher exists.
+    ///
+    /// \param g - random number engine
+    /// \param size - number of values in each buffer
+    /// \param normal - if \p true, values are standard normal instead of
+    /// uniform, \p T must be \p float or \p double
+    ///
+    /// See also: rocrand_create_host_prefetcher()
+    template<class Generator>
+    host_prefetcher(Generator& g, size_t size, bool normal = false)
+        : m_size(size)
+    {
+        if(normal && std::is_same<unsigned int, T>::value)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_TYPE_ERROR);
+        }
+        rocrand_status status;
+        status = rocrand_create_host_prefetcher(&m_prefetcher, g.m_generator, this->type(normal), size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    host_prefetcher(const host_prefetcher&) = delete;
+    host_prefetcher& operator=(const host_prefetcher&) = delete;
+
+    /// Destructs the prefetcher.
+    ///
+    /// See also: rocrand_destroy_host_prefetcher()
+    ~host_prefetcher() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_host_prefetcher(m_prefetcher);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Returns the next buffer of size() values in host memory.
+    ///
+    /// The returned pointer is valid until the next call of next().
+    ///
+    /// See also: rocrand_host_prefetcher_next()
+    const T * next()
+    {
+        const void * output;
+        rocrand_status status = rocrand_host_prefetcher_next(m_prefetcher, &output);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        return static_cast<const T *>(output);
+    }
+
+    /// Returns the number of values in each buffer.
+    size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    static rocrand_prefetch_type type(bool normal)
+    {
+        if(std::is_same<unsigned int, T>::value)
+            return ROCRAND_PREFETCH_UINT;
+        if(std::is_same<float, T>::value)
+            return normal ? ROCRAND_PREFETCH_NORMAL_FLOAT : ROCRAND_PREFETCH_UNIFORM_FLOAT;
+        return normal ? ROCRAND_PREFETCH_NORMAL_DOUBLE : ROCRAND_PREFETCH_UNIFORM_DOUBLE;
+    }
+
+    rocrand_host_prefetcher m_prefetcher;
+    size_t m_size;
+};
+
 /// \brief Pseudorandom number engine based Philox algorithm.
 ///
 /// philox4x32_10_engine implements
@@ -1017,6 +1115,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::host_prefetcher;
     /// \endcond
 };
 
@@ -1142,6 +1243,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::host_prefetcher;
     /// \endcond
 };
 
@@ -1266,6 +1370,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::host_prefetcher;
     /// \endcond
 };
 
@@ -1389,6 +1496,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::host_prefetcher;
     /// \endcond
 };
 
@@ -1546,6 +1656,9 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::host_prefetcher;
     /// \endcond
 };
 
@@ -0,0 +1,531 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BINOMIAL_H_
+#define ROCRAND_BINOMIAL_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_sobol32.h"
+#include "rocrand_mtgp32.h"
+
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+#include "rocrand_poisson.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Below this value of n * min(p, 1 - p) inversion is faster than BTPE
+constexpr double binomial_threshold_inv  = 30.0;
+// Above this value of mean inversion (one uniform value per result)
+// is replaced by normal approximation
+constexpr double binomial_threshold_huge = 400.0;
+
+FQUALIFIERS
+unsigned int binomial_distribution_search(double u, unsigned int n, double r)
+{
+    // Inversion by sequential search (BINV)
+    // Kachitvichyanukul, V., Schmeiser, B. W.
+    // Binomial Random Variate Generation, 1988
+    //
+    // r <= 0.5, the search is limited by mean + 10 standard deviations
+
+    const double q = 1.0 - r;
+    const double s = r / q;
+    const double a = (n + 1.0) * s;
+    const double mean = n * r;
+    const double bound = fmin(static_cast<double>(n), mean + 10.0 * sqrt(mean * q + 1.0));
+
+    double px = exp(n * log(q));
+    unsigned int x = 0;
+    while (u > px && x < bound)
+    {
+        u -= px;
+        x++;
+        px *= a / x - s;
+    }
+    return x;
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution_btpe(State& state, unsigned int trials, double r)
+{
+    // Triangle, parallelogram, exponential (BTPE)
+    // Kachitvichyanukul, V., Schmeiser, B. W.
+    // Binomial Random Variate Generation, 1988
+    //
+    // r <= 0.5, n * r >= binomial_threshold_inv
+
+    const double n = trials;
+    const double q = 1.0 - r;
+    const double nrq = n * r * q;
+    const double fm = n * r + r;
+    const long long m = static_cast<long long>(floor(fm));
+    const double p1 = floor(2.195 * sqrt(nrq) - 4.6 * q) + 0.5;
+    const double xm = m + 0.5;
+    const double xl = xm - p1;
+    const double xr = xm + p1;
+    const double c = 0.134 + 20.5 / (15.3 + m);
+    const double al = (fm - xl) / (fm - xl * r);
+    const double laml = al * (1.0 + al / 2.0);
+    const double ar = (xr - fm) / (xr * q);
+    const double lamr = ar * (1.0 + ar / 2.0);
+    const double p2 = p1 * (1.0 + 2.0 * c);
+    const double p3 = p2 + c / laml;
+    const double p4 = p3 + c / lamr;
+
+    while (true)
+    {
+        const double u = rocrand_uniform_double(state) * p4;
+        double v = rocrand_uniform_double(state);
+        long long y;
+        if (u <= p1)
+        {
+            // Triangular region, accept immediately
+            y = static_cast<long long>(floor(xm - p1 * v + u));
+            return static_cast<unsigned int>(y);
+        }
+        else if (u <= p2)
+        {
+            // Parallelogram region
+            const double x = xl + (u - p1) / c;
+            v = v * c + 1.0 - fabs(m - x + 0.5) / p1;
+            if (v > 1.0)
+            {
+                continue;
+            }
+            y = static_cast<long long>(floor(x));
+        }
+        else if (u <= p3)
+        {
+            // Left exponential tail
+            const double x = floor(xl + log(v) / laml);
+            if (x < 0.0)
+            {
+                continue;
+            }
+            y = static_cast<long long>(x);
+            v = v * (u - p2) * laml;
+        }
+        else
+        {
+            // Right exponential tail
+            const double x = floor(xr - log(v) / lamr);
+            if (x > n)
+            {
+                continue;
+            }
+            y = static_cast<long long>(x);
+            v = v * (u - p3) * lamr;
+        }
+
+        const long long k = y > m ? y - m : m - y;
+        if (k <= 20 || k >= nrq / 2.0 - 1.0)
+        {
+            // Explicit evaluation of f(y) / f(m)
+            const double s = r / q;
+            const double a = s * (n + 1.0);
+            double f = 1.0;
+            if (m < y)
+            {
+                for (long long i = m + 1; i <= y; i++)
+                {
+                    f *= a / i - s;
+                }
+            }
+            else if (m > y)
+            {
+                for (long long i = y + 1; i <= m; i++)
+                {
+                    f /= a / i - s;
+                }
+            }
+            if (v <= f)
+            {
+                return static_cast<unsigned int>(y);
+            }
+            continue;
+        }
+
+        // Squeezing using upper and lower bounds on log(f(y))
+        const double rho = (k / nrq) * ((k * (k / 3.0 + 0.625) + 0.1666666666666) / nrq + 0.5);
+        const double t = -(static_cast<double>(k) * k) / (2.0 * nrq);
+        const double la = log(v);
+        if (la < t - rho)
+        {
+            return static_cast<unsigned int>(y);
+        }
+        if (la > t + rho)
+        {
+            continue;
+        }
+
+        // Final acceptance/rejection test using Stirling's formula
+        const double x1 = y + 1.0;
+        const double f1 = m + 1.0;
+        const double z = n + 1.0 - m;
+        const double w = n - y + 1.0;
+        const double x2 = x1 * x1;
+        const double f2 = f1 * f1;
+        const double z2 = z * z;
+        const double w2 = w * w;
+        const double bound =
+            xm * log(f1 / x1) + (n - m + 0.5) * log(z / w) + (y - m) * log(w * r / (x1 * q))
+            + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / f2) / f2) / f2) / f2) / f1 / 166320.0
+            + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / z2) / z2) / z2) / z2) / z / 166320.0
+            + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / x2) / x2) / x2) / x2) / x1 / 166320.0
+            + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / w2) / w2) / w2) / w2) / w / 166320.0;
+        if (la <= bound)
+        {
+            return static_cast<unsigned int>(y);
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution(State& state, unsigned int n, double p)
+{
+    const double r = fmin(p, 1.0 - p);
+    unsigned int x;
+    if (n * r < binomial_threshold_inv)
+    {
+        x = binomial_distribution_search(rocrand_uniform_double(state), n, r);
+    }
+    else
+    {
+        x = binomial_distribution_btpe(state, n, r);
+    }
+    return p > 0.5 ? n - x : x;
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution_inv(State& state, unsigned int n, double p)
+{
+    // Uses exactly one value from state
+    const double r = fmin(p, 1.0 - p);
+    unsigned int x;
+    if (n * r < binomial_threshold_huge)
+    {
+        x = binomial_distribution_search(rocrand_uniform_double(state), n, r);
+    }
+    else
+    {
+        // Approximate binomial distribution with normal distribution
+        const double mean = n * r;
+        const double y = round(mean + sqrt(mean * (1.0 - r)) * rocrand_normal_double(state));
+        x = static_cast<unsigned int>(fmin(fmax(y, 0.0), static_cast<double>(n)));
+    }
+    return p > 0.5 ? n - x : x;
+}
+
+template<class State>
+FQUALIFIERS
+double gamma_distribution(State& state, double alpha)
+{
+    // Marsaglia, G., Tsang, W. W.
+    // A Simple Method for Generating Gamma Variables, 2000
+
+    double boost = 1.0;
+    if (alpha < 1.0)
+    {
+        // Gamma(alpha) = Gamma(alpha + 1) * U^(1 / alpha)
+        boost = pow(rocrand_uniform_double(state), 1.0 / alpha);
+        alpha += 1.0;
+    }
+
+    const double d = alpha - 1.0 / 3.0;
+    const double c = 1.0 / sqrt(9.0 * d);
+    while (true)
+    {
+        double x;
+        double v;
+        do
+        {
+            x = rocrand_normal_double(state);
+            v = 1.0 + c * x;
+        }
+        while (v <= 0.0);
+        v = v * v * v;
+        const double u = rocrand_uniform_double(state);
+        const double x2 = x * x;
+        if (u < 1.0 - 0.0331 * x2 * x2
+            || log(u) < 0.5 * x2 + d * (1.0 - v + log(v)))
+        {
+            return boost * d * v;
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int negative_binomial_distribution(State& state, double r, double p)
+{
+    // Gamma-Poisson mixture:
+    // NB(r, p) = Poisson(lambda), lambda ~ Gamma(r, (1 - p) / p)
+    const double lambda = gamma_distribution(state, r) * (1.0 - p) / p;
+    return poisson_distribution(state, lambda);
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int negative_binomial_distribution_inv(State& state, double r, double p)
+{
+    // Uses exactly one value from state
+    const double q = 1.0 - p;
+    const double mean = r * q / p;
+    const double stddev = sqrt(mean / p);
+    const double log_p0 = r * log(p);
+    if (mean < 1000.0 && log_p0 > -500.0)
+    {
+        // Inversion by sequential search,
+        // the search is limited by mean + 10 standard deviations
+        const double bound = mean + 10.0 * stddev + 1.0;
+        double u = rocrand_uniform_double(state);
+        double px = exp(log_p0);
+        unsigned int x = 0;
+        while (u > px && x < bound)
+        {
+            u -= px;
+            px *= (x + r) / (x + 1.0) * q;
+            x++;
+        }
+        return x;
+    }
+    else
+    {
+        // Approximate negative binomial distribution with normal distribution
+        const double y = round(mean + stddev * rocrand_normal_double(state));
+        return static_cast<unsigned int>(fmax(y, 0.0));
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Philox generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using Philox generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success in each trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_philox4x32_10 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MRG32k3a generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using MRG32k3a generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success in each trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_mrg32k3a * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using XORWOW generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using XORWOW generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success in each trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_xorwow * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MTGP32 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using MTGP32 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success in each trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_mtgp32 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SOBOL32 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using SOBOL32 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Probability of success in each trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_sobol32 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a negative binomially distributed <tt>unsigned int</tt> using Philox generator.
+ *
+ * Generates and returns negative binomially distributed random <tt>unsigned int</tt>
+ * values (numbers of failures before \p r successes) using Philox generator
+ * in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param r - Number of successes, can be non-integer
+ * \param p - Probability of success in each trial
+ *
+ * \return Negative binomially distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_negative_binomial(rocrand_state_philox4x32_10 * state, double r, double p)
+{
+    return rocrand_device::detail::negative_binomial_distribution(state, r, p);
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns a negative binomially distributed <tt>unsigned int</tt> using MRG32k3a generator.
+ *
+ * Generates and returns negative binomially distributed random <tt>unsigned int</tt>
+ * values (numbers of failures before \p r successes) using MRG32k3a generator
+ * in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param r - Number of successes, can be non-integer
+ * \param p - Probability of success in each trial
+ *
+ * \return Negative binomially distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_negative_binomial(rocrand_state_mrg32k3a * state, double r, double p)
+{
+    return rocrand_device::detail::negative_binomial_distribution(state, r, p);
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns a negative binomially distributed <tt>unsigned int</tt> using XORWOW generator.
+ *
+ * Generates and returns negative binomially distributed random <tt>unsigned int</tt>
+ * values (numbers of failures before \p r successes) using XORWOW generator
+ * in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param r - Number of successes, can be non-integer
+ * \param p - Probability of success in each trial
+ *
+ * \return Negative binomially distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_negative_binomial(rocrand_state_xorwow * state, double r, double p)
+{
+    return rocrand_device::detail::negative_binomial_distribution(state, r, p);
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns a negative binomially distributed <tt>unsigned int</tt> using MTGP32 generator.
+ *
+ * Generates and returns negative binomially distributed random <tt>unsigned int</tt>
+ * values (numbers of failures before \p r successes) using MTGP32 generator
+ * in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param r - Number of successes, can be non-integer
+ * \param p - Probability of success in each trial
+ *
+ * \return Negative binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_negative_binomial(rocrand_state_mtgp32 * state, double r, double p)
+{
+    return rocrand_device::detail::negative_binomial_distribution_inv(state, r, p);
+}
+
+/**
+ * \brief Returns a negative binomially distributed <tt>unsigned int</tt> using SOBOL32 generator.
+ *
+ * Generates and returns negative binomially distributed random <tt>unsigned int</tt>
+ * values (numbers of failures before \p r successes) using SOBOL32 generator
+ * in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param r - Number of successes, can be non-integer
+ * \param p - Probability of success in each trial
+ *
+ * \return Negative binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_negative_binomial(rocrand_state_sobol32 * state, double r, double p)
+{
+    return rocrand_device::detail::negative_binomial_distribution_inv(state, r, p);
+}
+
+#endif // ROCRAND_BINOMIAL_H_
+
+/** @} */ // end of group rocranddevice
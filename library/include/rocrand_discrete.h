@@ -44,6 +44,11 @@
 //
 // Vose M. D.
 // A Linear Algorithm For Generating Random Numbers With a Given Distribution, 1991
+//
+// Guide table (indexed search)
+//
+// Chen, H.-C., Asau, Y.
+// On Generating Random Variates from an Empirical Distribution, 1974
 
 namespace rocrand_device {
 namespace detail {
@@ -100,6 +105,39 @@ unsigned int discrete_cdf(const unsigned int r, const rocrand_discrete_distribut
     return discrete_cdf(x, dis);
 }
 
+FQUALIFIERS
+unsigned int discrete_cdf_guide(const double x, const rocrand_discrete_distribution_st& dis)
+{
+    // Calculate value using guide table and short sequential search in CDF.
+    // The result is the same as the result of discrete_cdf but the expected
+    // number of memory accesses is constant (not log(size)), and neighbouring
+    // values of x (e.g. from quasirandom generators) read neighbouring entries.
+
+    // Structs created without a guide table (e.g. filled by hand before
+    // the guide member was added) use binary search
+    if (dis.guide == NULL)
+    {
+        return discrete_cdf(x, dis);
+    }
+
+    // x is [0, 1)
+    const unsigned int j = static_cast<unsigned int>(dis.size * x);
+    unsigned int i = dis.guide[j < dis.size ? j : dis.size - 1];
+    while (i < dis.size - 1 && x > dis.cdf[i])
+    {
+        i++;
+    }
+
+    return dis.offset + i;
+}
+
+FQUALIFIERS
+unsigned int discrete_cdf_guide(const unsigned int r, const rocrand_discrete_distribution_st& dis)
+{
+    const double x = r * ROCRAND_2POW32_INV_DOUBLE;
+    return discrete_cdf_guide(x, dis);
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -201,7 +239,7 @@ unsigned int rocrand_discrete(rocrand_state_xorwow * state, const rocrand_discre
 FQUALIFIERS
 unsigned int rocrand_discrete(rocrand_state_mtgp32 * state, const rocrand_discrete_distribution discrete_distribution)
 {
-    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+    return rocrand_device::detail::discrete_cdf_guide(rocrand(state), *discrete_distribution);
 }
 
 /**
@@ -219,7 +257,7 @@ unsigned int rocrand_discrete(rocrand_state_mtgp32 * state, const rocrand_discre
 FQUALIFIERS
 unsigned int rocrand_discrete(rocrand_state_sobol32 * state, const rocrand_discrete_distribution discrete_distribution)
 {
-    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+    return rocrand_device::detail::discrete_cdf_guide(rocrand(state), *discrete_distribution);
 }
 
 #endif // ROCRAND_DISCRETE_H_
@@ -32,6 +32,11 @@ struct rocrand_discrete_distribution_st
 
     // Cumulative distribution function
     double * cdf;
+
+    // Guide table for indexed search in CDF (Chen-Asau), guide[i] is
+    // the first index which can be returned for x in [i/size, (i+1)/size).
+    // NULL if there is no guide table, then binary search in CDF is used
+    unsigned int * guide;
 };
 
 typedef struct rocrand_discrete_distribution_st * rocrand_discrete_distribution;
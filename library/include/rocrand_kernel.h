@@ -39,7 +39,9 @@
 #include "rocrand_uniform.h"
 #include "rocrand_normal.h"
 #include "rocrand_log_normal.h"
+#include "rocrand_truncated_normal.h"
 #include "rocrand_poisson.h"
+#include "rocrand_binomial.h"
 #include "rocrand_discrete.h"
 
 #endif // ROCRAND_KERNEL_H_
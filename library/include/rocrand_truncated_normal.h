@@ -0,0 +1,490 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_TRUNCATED_NORMAL_H_
+#define ROCRAND_TRUNCATED_NORMAL_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_sobol32.h"
+#include "rocrand_mtgp32.h"
+
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Bounds of standard normal distribution after which (far tails)
+// rejection sampling is used instead of inversion
+constexpr float truncated_normal_threshold_tail = 3.0f;
+
+// Bounds of standard normal distribution after which values of CDF
+// underflow (or lose precision) in float and double
+constexpr float truncated_normal_threshold_float = 12.0f;
+constexpr double truncated_normal_threshold_double = 37.0;
+
+FQUALIFIERS
+float normal_cdf(float x)
+{
+    return 0.5f * erfcf(-x * (1.0f / ROCRAND_SQRT2));
+}
+
+FQUALIFIERS
+double normal_cdf_double(double x)
+{
+    return 0.5 * erfc(-x * (1.0 / ROCRAND_SQRT2_DOUBLE));
+}
+
+// Inverse of standard normal CDF for p in (0, 0.5] (it is accurate for tiny p,
+// values of p > 0.5 are supported but lose relative precision).
+// The initial approximation is refined by Newton's iterations on log(CDF(x)).
+FQUALIFIERS
+float normal_quantile(float p)
+{
+    float x;
+    if (p > 1e-4f)
+    {
+        x = ROCRAND_SQRT2 * roc_f_erfinv(2.0f * p - 1.0f);
+    }
+    else
+    {
+        // Asymptotic expansion of the tail
+        const float t = -2.0f * logf(p);
+        x = -sqrtf(t - logf(t) - logf(ROCRAND_2PI));
+    }
+    #pragma unroll
+    for (int i = 0; i < 2; i++)
+    {
+        const float c = normal_cdf(x);
+        const float d = expf(-0.5f * x * x) * (1.0f / sqrtf(ROCRAND_2PI));
+        x -= (logf(c) - logf(p)) * c / d;
+    }
+    return x;
+}
+
+FQUALIFIERS
+double normal_quantile_double(double p)
+{
+    double x;
+    if (p > 1e-8)
+    {
+        x = ROCRAND_SQRT2_DOUBLE * roc_d_erfinv(2.0 * p - 1.0);
+    }
+    else
+    {
+        // Asymptotic expansion of the tail
+        const double t = -2.0 * log(p);
+        x = -sqrt(t - log(t) - log(2.0 * ROCRAND_PI_DOUBLE));
+    }
+    #pragma unroll
+    for (int i = 0; i < 2; i++)
+    {
+        const double c = normal_cdf_double(x);
+        const double d = exp(-0.5 * x * x) * (1.0 / sqrt(2.0 * ROCRAND_PI_DOUBLE));
+        x -= (log(c) - log(p)) * c / d;
+    }
+    return x;
+}
+
+// Inversion on [lo, hi] where lo < -hi, u is (0, 1]
+FQUALIFIERS
+double truncated_normal_quantile_double(double u, double lo, double hi)
+{
+    if (hi < -truncated_normal_threshold_double)
+    {
+        // CDF underflows in double, the tail is approximated by the exponential
+        // distribution with rate -hi translated to hi (relative error of
+        // the density is about 1 / (2 * hi^2))
+        const double c = -hi;
+        const double x = hi + log1p((1.0 - u) * expm1(-c * (hi - lo))) / c;
+        return fmin(fmax(x, lo), hi);
+    }
+    const double cdf_lo = normal_cdf_double(lo);
+    const double cdf_hi = normal_cdf_double(hi);
+    const double x = normal_quantile_double(cdf_lo + u * (cdf_hi - cdf_lo));
+    return fmin(fmax(x, lo), hi);
+}
+
+FQUALIFIERS
+double truncated_normal_distribution_double(unsigned int v, double a, double b)
+{
+    // Use the lower half where values of CDF are accurate,
+    // the result is still increasing in v
+    if(a > -b)
+    {
+        return -truncated_normal_quantile_double((~v + 0.5) * ROCRAND_2POW32_INV_DOUBLE, -b, -a);
+    }
+    return truncated_normal_quantile_double((v + 0.5) * ROCRAND_2POW32_INV_DOUBLE, a, b);
+}
+
+// Inversion method, uses one 32-bit value. a and b are bounds of the
+// standard normal distribution, a < b, they may be infinite.
+FQUALIFIERS
+float truncated_normal_distribution(unsigned int v, float a, float b)
+{
+    // Use the lower half where values of CDF are accurate,
+    // the result is still increasing in v
+    const bool mirror = a > -b;
+    // u is (0, 1), ~v keeps full precision of 1 - u near 0
+    const float u = ((mirror ? ~v : v) + 0.5f) * ROCRAND_2POW32_INV;
+    const float lo = mirror ? -b : a;
+    const float hi = mirror ? -a : b;
+    if (hi < -truncated_normal_threshold_float)
+    {
+        // CDF underflows in float, the same method is used in double
+        return static_cast<float>(truncated_normal_distribution_double(v, a, b));
+    }
+    const float cdf_lo = normal_cdf(lo);
+    const float cdf_hi = normal_cdf(hi);
+    float x = normal_quantile(cdf_lo + u * (cdf_hi - cdf_lo));
+    x = fminf(fmaxf(x, lo), hi);
+    return mirror ? -x : x;
+}
+
+// Inversion method, uses two 32-bit values (53 bits of precision)
+FQUALIFIERS
+double truncated_normal_distribution_double(unsigned int v1, unsigned int v2, double a, double b)
+{
+    if(a > -b)
+    {
+        return -truncated_normal_quantile_double(uniform_distribution_double(~v1, ~v2), -b, -a);
+    }
+    return truncated_normal_quantile_double(uniform_distribution_double(v1, v2), a, b);
+}
+
+// Rejection sampling of the tail [a, b], a > 0
+//
+// Robert, C. P.
+// Simulation of truncated normal variables, 1995
+template<class State>
+FQUALIFIERS
+float truncated_normal_tail(State& state, float a, float b)
+{
+    if ((b - a) * a < 1.0f)
+    {
+        // Narrow interval: uniform proposal
+        while (true)
+        {
+            const float z = a + (b - a) * rocrand_uniform(state);
+            const float rho = expf(0.5f * (a * a - z * z));
+            if (rocrand_uniform(state) <= rho)
+            {
+                return fminf(z, b);
+            }
+        }
+    }
+    // Translated exponential proposal with the optimal rate
+    const float alpha = 0.5f * (a + sqrtf(a * a + 4.0f));
+    while (true)
+    {
+        const float z = a - logf(rocrand_uniform(state)) / alpha;
+        const float rho = expf(-0.5f * (z - alpha) * (z - alpha));
+        if (rocrand_uniform(state) <= rho && z <= b)
+        {
+            return z;
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+double truncated_normal_tail_double(State& state, double a, double b)
+{
+    if ((b - a) * a < 1.0)
+    {
+        // Narrow interval: uniform proposal
+        while (true)
+        {
+            const double z = a + (b - a) * rocrand_uniform_double(state);
+            const double rho = exp(0.5 * (a * a - z * z));
+            if (rocrand_uniform_double(state) <= rho)
+            {
+                return fmin(z, b);
+            }
+        }
+    }
+    // Translated exponential proposal with the optimal rate
+    const double alpha = 0.5 * (a + sqrt(a * a + 4.0));
+    while (true)
+    {
+        const double z = a - log(rocrand_uniform_double(state)) / alpha;
+        const double rho = exp(-0.5 * (z - alpha) * (z - alpha));
+        if (rocrand_uniform_double(state) <= rho && z <= b)
+        {
+            return z;
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+float truncated_normal_distribution(State& state, float a, float b)
+{
+    if (a >= truncated_normal_threshold_tail)
+    {
+        return truncated_normal_tail(state, a, b);
+    }
+    else if (b <= -truncated_normal_threshold_tail)
+    {
+        return -truncated_normal_tail(state, -b, -a);
+    }
+    return truncated_normal_distribution(rocrand(state), a, b);
+}
+
+template<class State>
+FQUALIFIERS
+double truncated_normal_distribution_double(State& state, double a, double b)
+{
+    if (a >= truncated_normal_threshold_tail)
+    {
+        return truncated_normal_tail_double(state, a, b);
+    }
+    else if (b <= -truncated_normal_threshold_tail)
+    {
+        return -truncated_normal_tail_double(state, -b, -a);
+    }
+    return truncated_normal_distribution_double(rocrand(state), a, b);
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/**
+ * \brief Returns a truncated normally distributed <tt>float</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>float</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using Philox generator in \p state. Inversion method is used when
+ * the interval contains values close to the mean, otherwise rejection sampling of
+ * the tail is used, so the state is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>float</tt> value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_philox4x32_10 * state, float a, float b)
+{
+    return rocrand_device::detail::truncated_normal_distribution(state, a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>double</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>double</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using Philox generator in \p state. Inversion method is used when
+ * the interval contains values close to the mean, otherwise rejection sampling of
+ * the tail is used, so the state is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>double</tt> value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_philox4x32_10 * state, double a, double b)
+{
+    return rocrand_device::detail::truncated_normal_distribution_double(state, a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>float</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>float</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using MRG32k3a generator in \p state. Inversion method is used when
+ * the interval contains values close to the mean, otherwise rejection sampling of
+ * the tail is used, so the state is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>float</tt> value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_mrg32k3a * state, float a, float b)
+{
+    return rocrand_device::detail::truncated_normal_distribution(state, a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>double</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>double</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using MRG32k3a generator in \p state. Inversion method is used when
+ * the interval contains values close to the mean, otherwise rejection sampling of
+ * the tail is used, so the state is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>double</tt> value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_mrg32k3a * state, double a, double b)
+{
+    return rocrand_device::detail::truncated_normal_distribution_double(state, a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>float</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>float</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using XORWOW generator in \p state. Inversion method is used when
+ * the interval contains values close to the mean, otherwise rejection sampling of
+ * the tail is used, so the state is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>float</tt> value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_xorwow * state, float a, float b)
+{
+    return rocrand_device::detail::truncated_normal_distribution(state, a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>double</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>double</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using XORWOW generator in \p state. Inversion method is used when
+ * the interval contains values close to the mean, otherwise rejection sampling of
+ * the tail is used, so the state is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>double</tt> value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_xorwow * state, double a, double b)
+{
+    return rocrand_device::detail::truncated_normal_distribution_double(state, a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>float</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>float</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using MTGP32 generator in \p state, and increments position of the generator
+ * by one. Inversion method is used.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>float</tt> value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_mtgp32 * state, float a, float b)
+{
+    return rocrand_device::detail::truncated_normal_distribution(rocrand(state), a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>double</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>double</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using MTGP32 generator in \p state, and increments position of the generator
+ * by one. Inversion method is used.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>double</tt> value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_mtgp32 * state, double a, double b)
+{
+    return rocrand_device::detail::truncated_normal_distribution_double(rocrand(state), a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>float</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>float</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using SOBOL32 generator in \p state, and increments position of the generator
+ * by one. Inversion method is used.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>float</tt> value
+ */
+FQUALIFIERS
+float rocrand_truncated_normal(rocrand_state_sobol32 * state, float a, float b)
+{
+    return rocrand_device::detail::truncated_normal_distribution(rocrand(state), a, b);
+}
+
+/**
+ * \brief Returns a truncated normally distributed <tt>double</tt> value.
+ *
+ * Generates and returns a standard normally distributed <tt>double</tt> value
+ * restricted to the interval [\p a, \p b] (\p a < \p b, bounds can be infinite)
+ * using SOBOL32 generator in \p state, and increments position of the generator
+ * by one. Inversion method is used.
+ *
+ * \param state - Pointer to a state to use
+ * \param a - Lower bound
+ * \param b - Upper bound
+ *
+ * \return Truncated normally distributed <tt>double</tt> value
+ */
+FQUALIFIERS
+double rocrand_truncated_normal_double(rocrand_state_sobol32 * state, double a, double b)
+{
+    return rocrand_device::detail::truncated_normal_distribution_double(rocrand(state), a, b);
+}
+
+#endif // ROCRAND_TRUNCATED_NORMAL_H_
+
+/** @} */ // end of group rocranddevice
@@ -25,6 +25,18 @@
 #define FQUALIFIERS __forceinline__ __device__ __host__
 #endif
 
+// Host generators do not use Box-Muller caches of device engines, without
+// them generate kernels load and save 24 instead of 48 bytes per XORWOW or
+// MRG32k3a engine (Philox engines are not stored, they are created by kernels).
+// The macros have effect only if engines are not declared yet. Code outside
+// the library which includes its headers after rocrand_kernel.h (e.g. host
+// benchmarks of the device API) defines ROCRAND_DETAIL_ENGINES_DECLARED_BEFORE
+// and keeps engines with caches.
+#if !defined(ROCRAND_DETAIL_ENGINES_DECLARED_BEFORE) \
+    && (defined(ROCRAND_PHILOX4X32_10_H_) || defined(ROCRAND_MRG32K3A_H_) || defined(ROCRAND_XORWOW_H_))
+    #error "device_engines.hpp must be included before rocrand_kernel.h"
+#endif
+
 #define ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
@@ -0,0 +1,184 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+
+#include <climits>
+#include <algorithm>
+#include <vector>
+
+#include <rocrand.h>
+
+#include "discrete.hpp"
+#include "table_cache.hpp"
+#include "../trace.hpp"
+
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class rocrand_binomial_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
+{
+public:
+
+    typedef rocrand_discrete_distribution_base<Method, IsHostSide> base;
+
+    rocrand_binomial_distribution()
+        : base() { }
+
+    rocrand_binomial_distribution(unsigned int trials, double probability)
+        : rocrand_binomial_distribution()
+    {
+        set_parameters(trials, probability);
+    }
+
+    __host__ __device__
+    ~rocrand_binomial_distribution() { }
+
+    void set_parameters(unsigned int trials, double probability)
+    {
+        const double variance = trials * probability * (1.0 - probability);
+        const size_t capacity = std::min(
+            2 * static_cast<size_t>(16.0 * (2.0 + std::sqrt(variance))),
+            static_cast<size_t>(trials) + 1
+        );
+        std::vector<double> p(capacity);
+
+        calculate_probabilities(p, capacity, trials, probability);
+
+        this->init(p, this->size, this->offset);
+    }
+
+protected:
+
+    void calculate_probabilities(std::vector<double>& p, const size_t capacity,
+                                 const unsigned int trials, const double probability)
+    {
+        if (probability == 0.0 || probability == 1.0)
+        {
+            p[0] = 1.0;
+            this->size = 1;
+            this->offset = probability == 0.0 ? 0 : trials;
+            return;
+        }
+
+        const double p_epsilon = 1e-12;
+        const double n = trials;
+        const double log_p = std::log(probability);
+        const double log_q = std::log1p(-probability);
+        const double log_n_factorial = std::lgamma(n + 1.0);
+
+        // The window [left, left + capacity) is centered at the mode and
+        // is clamped to [0, trials]
+        const double mode = std::min(std::floor((n + 1.0) * probability), n);
+        const double left = std::min(
+            std::max(mode - static_cast<double>(capacity / 2), 0.0),
+            n + 1.0 - capacity
+        );
+        const int center = static_cast<int>(mode - left);
+
+        auto pmf = [&](const double x)
+        {
+            return std::exp(
+                log_n_factorial - std::lgamma(x + 1.0) - std::lgamma(n - x + 1.0)
+                + x * log_p + (n - x) * log_q
+            );
+        };
+
+        // Calculate probabilities starting from mode in both directions
+        int lo = 0;
+        for (int i = center; i >= 0; i--)
+        {
+            const double pp = pmf(left + i);
+            if (pp < p_epsilon)
+            {
+                lo = i + 1;
+                break;
+            }
+            p[i] = pp;
+        }
+
+        int hi = capacity - 1;
+        for (int i = center + 1; i < static_cast<int>(capacity); i++)
+        {
+            const double pp = pmf(left + i);
+            if (pp < p_epsilon)
+            {
+                hi = i - 1;
+                break;
+            }
+            p[i] = pp;
+        }
+
+        for (int i = lo; i <= hi; i++)
+        {
+            p[i - lo] = p[i];
+        }
+
+        this->size = hi - lo + 1;
+        this->offset = static_cast<unsigned int>(left) + lo;
+    }
+};
+
+// Handles caching of precomputed tables for the distribution and recomputes
+// them only when trials or probability are changed. Tables of prepared
+// parameters are kept.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class binomial_distribution_manager
+{
+public:
+
+    typedef rocrand_binomial_distribution<Method, IsHostSide> distribution_type;
+    typedef std::pair<unsigned int, double> parameters_type;
+
+    // Table of the current parameters
+    const distribution_type& dis() const
+    {
+        return m_tables.current;
+    }
+
+    // Makes the table of the parameters current, returns true if it was built
+    bool set_parameters(unsigned int trials, double probability, hipStream_t stream)
+    {
+        return m_tables.select(parameters_type(trials, probability), stream, &build);
+    }
+
+    // Keeps the table of the parameters, returns true if it was built
+    bool prepare(unsigned int trials, double probability)
+    {
+        return m_tables.prepare(parameters_type(trials, probability), &build);
+    }
+
+    // Frees all kept tables
+    void release_prepared()
+    {
+        m_tables.release_prepared();
+    }
+
+private:
+
+    static void build(distribution_type& dis, const parameters_type& parameters)
+    {
+        rocrand_host::detail::trace_scope trace("rocrand_build_table", NULL, "binomial");
+        dis.set_parameters(parameters.first, parameters.second);
+    }
+
+    table_cache<distribution_type, parameters_type> m_tables;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
@@ -0,0 +1,231 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
+#define ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
+
+#include <cmath>
+#include <map>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "table_cache.hpp"
+#include "../trace.hpp"
+
+// Maximum number of normal values that contribute to one point of a path.
+// Rows of the bridge matrix follow the bisection tree, so for the maximum
+// number of Sobol dimensions (20000) each row has at most 16 terms.
+#define ROCRAND_BROWNIAN_BRIDGE_MAX_TERMS 32
+
+// Brownian bridge construction of a path with unit time steps
+// t = 1, 2, ..., dimensions.
+//
+// The usual construction visits the points in bisection order: the last point
+// is built from the first normal value, the middle point from the last point
+// and the second normal value, and so on. Because every point depends only on
+// previously built points, W[t] is a linear combination of normal values z[k]
+// of the points visited before it along the bisection tree. These combinations
+// are precomputed as a sparse (CSR) matrix, so a path can be generated one time
+// step (Sobol dimension) at a time, without storing the whole path per thread.
+class rocrand_brownian_bridge
+{
+public:
+    unsigned int dimensions;
+    // Row t: coefficients[row_offsets[t] .. row_offsets[t + 1])
+    // of normal values z[columns[...]]
+    unsigned int * row_offsets;
+    unsigned int * columns;
+    double * coefficients;
+
+    rocrand_brownian_bridge()
+        : dimensions(0), row_offsets(NULL), columns(NULL), coefficients(NULL)
+    { }
+
+    void deallocate()
+    {
+        if(row_offsets != NULL)
+        {
+            hipFree(row_offsets);
+            hipFree(columns);
+            hipFree(coefficients);
+            row_offsets = NULL;
+            columns = NULL;
+            coefficients = NULL;
+        }
+    }
+
+    void set_dimensions(unsigned int new_dimensions)
+    {
+        typedef std::map<unsigned int, double> row_type;
+
+        const unsigned int size = new_dimensions;
+        std::vector<unsigned int> map(size, 0);
+        std::vector<unsigned int> bridge_index(size), left_index(size), right_index(size);
+        std::vector<double> left_weight(size, 0.0), right_weight(size, 0.0), stddev(size, 0.0);
+
+        map[size - 1] = 1;
+        bridge_index[0] = size - 1;
+        stddev[0] = std::sqrt(static_cast<double>(size));
+        for(unsigned int i = 1, j = 0; i < size; i++)
+        {
+            // Find the next interval [j - 1, k] with unconstructed points
+            while(map[j]) j++;
+            unsigned int k = j;
+            while(!map[k]) k++;
+            const unsigned int l = j + ((k - 1 - j) >> 1);
+            map[l] = i;
+            bridge_index[i] = l;
+            left_index[i] = j;
+            right_index[i] = k;
+            // Times are l + 1, k + 1 and j (0 for the start of the path)
+            const double tl = l + 1.0;
+            const double tk = k + 1.0;
+            const double tj = j;
+            left_weight[i] = (tk - tl) / (tk - tj);
+            right_weight[i] = (tl - tj) / (tk - tj);
+            stddev[i] = std::sqrt((tl - tj) * (tk - tl) / (tk - tj));
+            j = k + 1;
+            if(j >= size) j = 0;
+        }
+
+        std::vector<row_type> rows(size);
+        rows[size - 1][0] = stddev[0];
+        for(unsigned int i = 1; i < size; i++)
+        {
+            const unsigned int j = left_index[i];
+            const unsigned int k = right_index[i];
+            row_type& row = rows[bridge_index[i]];
+            if(j != 0)
+            {
+                for(const auto& term : rows[j - 1])
+                    row[term.first] += left_weight[i] * term.second;
+            }
+            for(const auto& term : rows[k])
+                row[term.first] += right_weight[i] * term.second;
+            row[i] += stddev[i];
+        }
+
+        std::vector<unsigned int> h_row_offsets(size + 1);
+        std::vector<unsigned int> h_columns;
+        std::vector<double> h_coefficients;
+        h_row_offsets[0] = 0;
+        for(unsigned int t = 0; t < size; t++)
+        {
+            if(rows[t].size() > ROCRAND_BROWNIAN_BRIDGE_MAX_TERMS)
+            {
+                throw ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            for(const auto& term : rows[t])
+            {
+                h_columns.push_back(term.first);
+                h_coefficients.push_back(term.second);
+            }
+            h_row_offsets[t + 1] = static_cast<unsigned int>(h_columns.size());
+        }
+
+        deallocate();
+        dimensions = 0;
+
+        hipError_t error;
+        error = hipMalloc(&row_offsets, sizeof(unsigned int) * h_row_offsets.size());
+        if(error != hipSuccess)
+        {
+            row_offsets = NULL;
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMalloc(&columns, sizeof(unsigned int) * h_columns.size());
+        if(error != hipSuccess)
+        {
+            hipFree(row_offsets);
+            row_offsets = NULL;
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMalloc(&coefficients, sizeof(double) * h_coefficients.size());
+        if(error != hipSuccess)
+        {
+            hipFree(row_offsets);
+            hipFree(columns);
+            row_offsets = NULL;
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(hipMemcpy(row_offsets, h_row_offsets.data(),
+                     sizeof(unsigned int) * h_row_offsets.size(),
+                     hipMemcpyHostToDevice) != hipSuccess
+           || hipMemcpy(columns, h_columns.data(),
+                        sizeof(unsigned int) * h_columns.size(),
+                        hipMemcpyHostToDevice) != hipSuccess
+           || hipMemcpy(coefficients, h_coefficients.data(),
+                        sizeof(double) * h_coefficients.size(),
+                        hipMemcpyHostToDevice) != hipSuccess)
+        {
+            deallocate();
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        dimensions = new_dimensions;
+    }
+};
+
+// Handles caching of the bridge matrix and recomputes it only when
+// the number of dimensions (time steps) is changed. Matrices of prepared
+// numbers of dimensions are kept.
+class brownian_bridge_manager
+{
+public:
+
+    // Matrix of the current number of dimensions
+    const rocrand_brownian_bridge& bridge() const
+    {
+        return m_tables.current;
+    }
+
+    // Makes the matrix of dimensions current, returns true if it was built
+    bool set_dimensions(unsigned int dimensions, hipStream_t stream)
+    {
+        return m_tables.select(dimensions, stream, &build);
+    }
+
+    // Keeps the matrix of dimensions, returns true if it was built
+    bool prepare(unsigned int dimensions)
+    {
+        return m_tables.prepare(dimensions, &build);
+    }
+
+    // Frees all kept matrices
+    void release_prepared()
+    {
+        m_tables.release_prepared();
+    }
+
+private:
+
+    static void build(rocrand_brownian_bridge& bridge, const unsigned int& dimensions)
+    {
+        rocrand_host::detail::trace_scope trace(
+            "rocrand_build_table", NULL, "brownian_bridge", dimensions
+        );
+        bridge.set_dimensions(dimensions);
+    }
+
+    table_cache<rocrand_brownian_bridge, unsigned int> m_tables;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
@@ -30,6 +30,7 @@
 #include <rocrand_uniform.h>
 #include <rocrand_normal.h>
 #include <rocrand_log_normal.h>
+#include <rocrand_truncated_normal.h>
 #include <rocrand_discrete.h>
 
 #endif // ROCRAND_RNG_DISTRIBUTION_DEVICE_DISTRIBUTIONS_H_
@@ -22,6 +22,7 @@
 #define ROCRAND_RNG_DISTRIBUTION_DISCRETE_H_
 
 #include <climits>
+#include <cfloat>
 #include <algorithm>
 #include <vector>
 
@@ -36,12 +37,20 @@
 //
 // Vose M. D.
 // A Linear Algorithm For Generating Random Numbers With a Given Distribution, 1991
+//
+// Guide table (indexed search in CDF)
+//
+// Chen, H.-C., Asau, Y.
+// On Generating Random Variates from an Empirical Distribution, 1974
 
 enum rocrand_discrete_method
 {
     ROCRAND_DISCRETE_METHOD_ALIAS = 1,
     ROCRAND_DISCRETE_METHOD_CDF = 2,
+    // CDF with guide table, returns the same values as ROCRAND_DISCRETE_METHOD_CDF
+    ROCRAND_DISCRETE_METHOD_GUIDE_TABLE = 4,
     ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF
+        | ROCRAND_DISCRETE_METHOD_GUIDE_TABLE
 };
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
@@ -55,6 +64,7 @@ public:
         probability = NULL;
         alias = NULL;
         cdf = NULL;
+        guide = NULL;
     }
 
     rocrand_discrete_distribution_base(const double * probabilities,
@@ -89,6 +99,10 @@ public:
             {
                 delete[] cdf;
             }
+            if (guide != NULL)
+            {
+                delete[] guide;
+            }
         }
         else
         {
@@ -104,10 +118,15 @@ public:
             {
                 hipFree(cdf);
             }
+            if (guide != NULL)
+            {
+                hipFree(guide);
+            }
         }
         probability = NULL;
         alias = NULL;
         cdf = NULL;
+        guide = NULL;
     }
 
     __forceinline__ __host__ __device__
@@ -117,6 +136,10 @@ public:
         {
             return rocrand_device::detail::discrete_alias(x, *this);
         }
+        else if ((Method & ROCRAND_DISCRETE_METHOD_GUIDE_TABLE) != 0)
+        {
+            return rocrand_device::detail::discrete_cdf_guide(x, *this);
+        }
         else
         {
             return rocrand_device::detail::discrete_cdf(x, *this);
@@ -139,7 +162,7 @@ protected:
         {
             create_alias_table(p);
         }
-        if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        if ((Method & (ROCRAND_DISCRETE_METHOD_CDF | ROCRAND_DISCRETE_METHOD_GUIDE_TABLE)) != 0)
         {
             create_cdf(p);
         }
@@ -154,10 +177,14 @@ protected:
                 probability = new double[size];
                 alias = new unsigned int[size];
             }
-            if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+            if ((Method & (ROCRAND_DISCRETE_METHOD_CDF | ROCRAND_DISCRETE_METHOD_GUIDE_TABLE)) != 0)
             {
                 cdf = new double[size];
             }
+            if ((Method & ROCRAND_DISCRETE_METHOD_GUIDE_TABLE) != 0)
+            {
+                guide = new unsigned int[size];
+            }
         }
         else
         {
@@ -175,7 +202,7 @@ protected:
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
             }
-            if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+            if ((Method & (ROCRAND_DISCRETE_METHOD_CDF | ROCRAND_DISCRETE_METHOD_GUIDE_TABLE)) != 0)
             {
                 error = hipMalloc(&cdf, sizeof(double) * size);
                 if (error != hipSuccess)
@@ -183,6 +210,14 @@ protected:
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
             }
+            if ((Method & ROCRAND_DISCRETE_METHOD_GUIDE_TABLE) != 0)
+            {
+                error = hipMalloc(&guide, sizeof(unsigned int) * size);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+            }
         }
     }
 
@@ -300,6 +335,45 @@ protected:
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
             }
         }
+
+        if ((Method & ROCRAND_DISCRETE_METHOD_GUIDE_TABLE) != 0)
+        {
+            create_guide_table(h_cdf);
+        }
+    }
+
+    void create_guide_table(const std::vector<double>& h_cdf)
+    {
+        std::vector<unsigned int> h_guide(size);
+
+        // guide[j] is the smallest index that can be returned for x which
+        // falls into [j / size, (j + 1) / size). The lower bound is slightly
+        // decreased so rounding of size * x on device can't make the search
+        // start after the correct index (the search only goes forward).
+        unsigned int i = 0;
+        for (unsigned int j = 0; j < size; j++)
+        {
+            const double x = (static_cast<double>(j) / size) * (1.0 - 4.0 * DBL_EPSILON);
+            while (i < size - 1 && x > h_cdf[i])
+            {
+                i++;
+            }
+            h_guide[j] = i;
+        }
+
+        if (IsHostSide)
+        {
+            std::copy(h_guide.begin(), h_guide.end(), guide);
+        }
+        else
+        {
+            hipError_t error;
+            error = hipMemcpy(guide, h_guide.data(), sizeof(unsigned int) * size, hipMemcpyDefault);
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
     }
 };
 
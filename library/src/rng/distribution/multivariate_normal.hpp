@@ -0,0 +1,196 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Mean vector and packed (row by row) lower triangle of the Cholesky factor
+template<class T, unsigned int MaxDimensions>
+struct multivariate_normal_shared_data
+{
+    T mean[MaxDimensions];
+    T factor[MaxDimensions * (MaxDimensions + 1) / 2];
+};
+
+// Generates vectors y = mean + L * z, where z are independent standard
+// normal values and L is a lower triangular Cholesky factor of covariance.
+// Kernels load mean and L into shared memory once per block; z of one vector
+// is kept in registers (loops are unrolled up to MaxDimensions), so correlated
+// values are written directly without a separate matrix multiplication pass.
+template<class T>
+struct multivariate_normal_distribution
+{
+    const T * mean;
+    const T * factor;
+    const unsigned int dimensions;
+
+    __host__ __device__
+    multivariate_normal_distribution(const T * mean,
+                                     const T * factor,
+                                     const unsigned int dimensions) :
+                                     mean(mean), factor(factor),
+                                     dimensions(dimensions) {}
+
+    // All threads of the block must call this function
+    template<unsigned int MaxDimensions>
+    __forceinline__ __device__
+    void load(multivariate_normal_shared_data<T, MaxDimensions>& shared) const
+    {
+        for(unsigned int i = hipThreadIdx_x; i < dimensions * dimensions; i += hipBlockDim_x)
+        {
+            const unsigned int row = i / dimensions;
+            const unsigned int column = i % dimensions;
+            if(column <= row)
+            {
+                shared.factor[row * (row + 1) / 2 + column] = factor[i];
+            }
+            if(column == 0)
+            {
+                shared.mean[row] = mean[row];
+            }
+        }
+        __syncthreads();
+    }
+
+    // Generates one vector of dimensions values, Normal2 returns pairs
+    // of standard normal values. If output is NULL, values are generated
+    // but not saved (keeps engines with shared state in sync).
+    template<unsigned int MaxDimensions, class Normal2>
+    __forceinline__ __device__
+    void operator()(const multivariate_normal_shared_data<T, MaxDimensions>& shared,
+                    T * output,
+                    Normal2& normal2) const
+    {
+        T z[MaxDimensions];
+        #pragma unroll
+        for(unsigned int i = 0; i < MaxDimensions; i += 2)
+        {
+            if(i < dimensions)
+            {
+                const auto v = normal2();
+                z[i] = v.x;
+                if(i + 1 < MaxDimensions)
+                    z[i + 1] = v.y;
+            }
+        }
+
+        if(output == NULL)
+            return;
+
+        #pragma unroll
+        for(unsigned int i = 0; i < MaxDimensions; i++)
+        {
+            if(i < dimensions)
+            {
+                T y = shared.mean[i];
+                #pragma unroll
+                for(unsigned int j = 0; j <= i; j++)
+                {
+                    y += shared.factor[i * (i + 1) / 2 + j] * z[j];
+                }
+                output[i] = y;
+            }
+        }
+    }
+};
+
+// Generates pairs of standard normal values using Box-Muller transform
+template<class T, class Engine>
+struct normal2_generator;
+
+template<class Engine>
+struct normal2_generator<float, Engine>
+{
+    Engine& engine;
+
+    __forceinline__ __device__
+    normal2_generator(Engine& engine) : engine(engine) {}
+
+    __forceinline__ __device__
+    float2 operator()()
+    {
+        const unsigned int x = engine();
+        const unsigned int y = engine();
+        return rocrand_device::detail::box_muller(x, y);
+    }
+};
+
+template<class Engine>
+struct normal2_generator<double, Engine>
+{
+    Engine& engine;
+
+    __forceinline__ __device__
+    normal2_generator(Engine& engine) : engine(engine) {}
+
+    __forceinline__ __device__
+    double2 operator()()
+    {
+        const uint4 v = uint4 { engine(), engine(), engine(), engine() };
+        return rocrand_device::detail::box_muller_double(v);
+    }
+};
+
+template<class T, class Engine>
+struct mrg_normal2_generator;
+
+template<class Engine>
+struct mrg_normal2_generator<float, Engine>
+{
+    Engine& engine;
+
+    __forceinline__ __device__
+    mrg_normal2_generator(Engine& engine) : engine(engine) {}
+
+    __forceinline__ __device__
+    float2 operator()()
+    {
+        const unsigned int x = engine();
+        const unsigned int y = engine();
+        return rocrand_device::detail::mrg_normal_distribution2(x, y);
+    }
+};
+
+template<class Engine>
+struct mrg_normal2_generator<double, Engine>
+{
+    Engine& engine;
+
+    __forceinline__ __device__
+    mrg_normal2_generator(Engine& engine) : engine(engine) {}
+
+    __forceinline__ __device__
+    double2 operator()()
+    {
+        const unsigned int x = engine();
+        const unsigned int y = engine();
+        return rocrand_device::detail::mrg_normal_distribution_double2(x, y);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_MULTIVARIATE_NORMAL_H_
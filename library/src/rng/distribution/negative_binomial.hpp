@@ -0,0 +1,191 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_NEGATIVE_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_NEGATIVE_BINOMIAL_H_
+
+#include <climits>
+#include <new>
+#include <vector>
+
+#include <rocrand.h>
+
+#include "discrete.hpp"
+#include "table_cache.hpp"
+#include "../trace.hpp"
+
+// Negative binomial distribution: number of failures before the given
+// (possibly non-integer) number of successes occur in Bernoulli trials
+// with the given probability of success.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class rocrand_negative_binomial_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
+{
+public:
+
+    typedef rocrand_discrete_distribution_base<Method, IsHostSide> base;
+
+    rocrand_negative_binomial_distribution()
+        : base() { }
+
+    rocrand_negative_binomial_distribution(double successes, double probability)
+        : rocrand_negative_binomial_distribution()
+    {
+        set_parameters(successes, probability);
+    }
+
+    __host__ __device__
+    ~rocrand_negative_binomial_distribution() { }
+
+    void set_parameters(double successes, double probability)
+    {
+        std::vector<double> p;
+
+        calculate_probabilities(p, successes, probability);
+
+        this->init(p, this->size, this->offset);
+    }
+
+protected:
+
+    // Maximum number of values in tables. Wider distributions (for example,
+    // tiny probability of success) are rejected with ROCRAND_STATUS_OUT_OF_RANGE.
+    static const unsigned int max_size = 1 << 22;
+
+    void calculate_probabilities(std::vector<double>& p,
+                                 const double successes, const double probability)
+    {
+        if (probability == 1.0)
+        {
+            p.assign(1, 1.0);
+            this->size = 1;
+            this->offset = 0;
+            return;
+        }
+
+        const double p_epsilon = 1e-12;
+        const double r = successes;
+        const double log_p = std::log(probability);
+        const double log_q = std::log1p(-probability);
+        const double log_r_gamma = std::lgamma(r);
+
+        const double mode = r > 1.0
+            ? std::floor((r - 1.0) * (1.0 - probability) / probability)
+            : 0.0;
+        if (mode > static_cast<double>(UINT_MAX - max_size))
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        const unsigned int center = static_cast<unsigned int>(mode);
+
+        auto pmf = [&](const double x)
+        {
+            return std::exp(
+                std::lgamma(x + r) - std::lgamma(x + 1.0) - log_r_gamma
+                + r * log_p + x * log_q
+            );
+        };
+
+        // Non-negligible probabilities (>= p_epsilon) are found starting from
+        // the mode in both directions. The distribution is skewed to the right,
+        // for small successes its right tail is much longer than the standard
+        // deviation, so the table is not limited by a window around the mode.
+        unsigned int lo = center;
+        while (lo > 0 && pmf(lo - 1.0) >= p_epsilon)
+        {
+            lo--;
+            if (center - lo >= max_size)
+            {
+                throw ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+        }
+
+        for (unsigned int x = lo; ; x++)
+        {
+            const double pp = pmf(x);
+            if (x > center && pp < p_epsilon)
+            {
+                break;
+            }
+            if (p.size() == max_size)
+            {
+                throw ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            p.push_back(pp);
+        }
+
+        this->size = static_cast<unsigned int>(p.size());
+        this->offset = lo;
+    }
+};
+
+// Handles caching of precomputed tables for the distribution and recomputes
+// them only when successes or probability are changed. Tables of prepared
+// parameters are kept.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class negative_binomial_distribution_manager
+{
+public:
+
+    typedef rocrand_negative_binomial_distribution<Method, IsHostSide> distribution_type;
+    typedef std::pair<double, double> parameters_type;
+
+    // Table of the current parameters
+    const distribution_type& dis() const
+    {
+        return m_tables.current;
+    }
+
+    // Makes the table of the parameters current, returns true if it was built
+    bool set_parameters(double successes, double probability, hipStream_t stream)
+    {
+        return m_tables.select(parameters_type(successes, probability), stream, &build);
+    }
+
+    // Keeps the table of the parameters, returns true if it was built
+    bool prepare(double successes, double probability)
+    {
+        return m_tables.prepare(parameters_type(successes, probability), &build);
+    }
+
+    // Frees all kept tables
+    void release_prepared()
+    {
+        m_tables.release_prepared();
+    }
+
+private:
+
+    static void build(distribution_type& dis, const parameters_type& parameters)
+    {
+        rocrand_host::detail::trace_scope trace("rocrand_build_table", NULL, "negative_binomial");
+        try
+        {
+            dis.set_parameters(parameters.first, parameters.second);
+        }
+        catch(const std::bad_alloc&)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    table_cache<distribution_type, parameters_type> m_tables;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_NEGATIVE_BINOMIAL_H_
@@ -28,6 +28,8 @@
 #include <rocrand.h>
 
 #include "discrete.hpp"
+#include "table_cache.hpp"
+#include "../trace.hpp"
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class rocrand_poisson_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
@@ -111,36 +113,47 @@ protected:
 
 // Handles caching of precomputed tables for the distribution and recomputes
 // them only when lambda is changed (as these computations, device memory
-// allocations and copying take time).
+// allocations and copying take time). Tables of prepared lambdas are kept.
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class poisson_distribution_manager
 {
 public:
 
-    rocrand_poisson_distribution<Method, IsHostSide> dis;
+    typedef rocrand_poisson_distribution<Method, IsHostSide> distribution_type;
 
-    poisson_distribution_manager()
-        : lambda(0.0)
-    { }
+    // Table of the current lambda
+    const distribution_type& dis() const
+    {
+        return m_tables.current;
+    }
 
-    ~poisson_distribution_manager()
+    // Makes the table of new_lambda current, returns true if it was built
+    bool set_lambda(double new_lambda, hipStream_t stream)
     {
-        dis.deallocate();
+        return m_tables.select(new_lambda, stream, &build);
     }
 
-    void set_lambda(double new_lambda)
+    // Keeps the table of new_lambda, returns true if it was built
+    bool prepare(double new_lambda)
     {
-        const bool changed = lambda != new_lambda;
-        if (changed)
-        {
-            lambda = new_lambda;
-            dis.set_lambda(lambda);
-        }
+        return m_tables.prepare(new_lambda, &build);
+    }
+
+    // Frees all kept tables
+    void release_prepared()
+    {
+        m_tables.release_prepared();
     }
 
 private:
 
-    double lambda;
+    static void build(distribution_type& dis, const double& lambda)
+    {
+        rocrand_host::detail::trace_scope trace("rocrand_build_table", NULL, "poisson");
+        dis.set_lambda(lambda);
+    }
+
+    table_cache<distribution_type, double> m_tables;
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_POISSON_H_
@@ -0,0 +1,144 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_TABLE_CACHE_H_
+#define ROCRAND_RNG_DISTRIBUTION_TABLE_CACHE_H_
+
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "../stream_capture.hpp"
+
+// Device tables of a distribution (Table, it has deallocate()) for different
+// parameters (Parameters, compared with ==), build(table, parameters) builds
+// a table and throws rocrand_status on errors.
+//
+// The table of the last used parameters is rebuilt (and the previous one is
+// freed) when parameters are changed. Prepared tables are kept until they are
+// released or the cache is destroyed, switching between them does not allocate
+// or copy memory, so it is done during stream capture too.
+template<class Table, class Parameters>
+class table_cache
+{
+public:
+
+    // The current table: a copy of one of the cached tables (it does not own memory)
+    Table current;
+
+    table_cache()
+        : m_last_valid(false)
+    { }
+
+    ~table_cache()
+    {
+        m_last.deallocate();
+        for(size_t i = 0; i < m_prepared.size(); i++)
+        {
+            m_prepared[i].second.deallocate();
+        }
+    }
+
+    // Makes the table of parameters current, builds it if it is not cached.
+    // Returns true if the table was built. Throws ROCRAND_STATUS_LAUNCH_FAILURE
+    // if the table must be built while stream is being captured (the caller
+    // must prepare it before capture).
+    template<class Build>
+    bool select(const Parameters& parameters, hipStream_t stream, Build build)
+    {
+        for(size_t i = 0; i < m_prepared.size(); i++)
+        {
+            if(m_prepared[i].first == parameters)
+            {
+                current = m_prepared[i].second;
+                return false;
+            }
+        }
+        if(m_last_valid && m_last_parameters == parameters)
+        {
+            current = m_last;
+            return false;
+        }
+        if(rocrand_host::detail::is_capturing(stream))
+        {
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        m_last_valid = false;
+        build(m_last, parameters);
+        m_last_parameters = parameters;
+        m_last_valid = true;
+        current = m_last;
+        return true;
+    }
+
+    // Keeps the table of parameters until release_prepared() or destruction
+    // of the cache, builds it if it is not cached. Returns true if the table
+    // was built.
+    template<class Build>
+    bool prepare(const Parameters& parameters, Build build)
+    {
+        for(size_t i = 0; i < m_prepared.size(); i++)
+        {
+            if(m_prepared[i].first == parameters)
+            {
+                return false;
+            }
+        }
+        Table table;
+        bool built = false;
+        if(m_last_valid && m_last_parameters == parameters)
+        {
+            // The last table becomes prepared (current may still be its copy)
+            table = m_last;
+            m_last = Table();
+            m_last_valid = false;
+        }
+        else
+        {
+            build(table, parameters);
+            built = true;
+        }
+        m_prepared.push_back(std::make_pair(parameters, table));
+        return built;
+    }
+
+    // Frees all prepared tables, the table of the last used parameters is kept
+    void release_prepared()
+    {
+        for(size_t i = 0; i < m_prepared.size(); i++)
+        {
+            m_prepared[i].second.deallocate();
+        }
+        m_prepared.clear();
+        // current may be a copy of a freed table, select() sets it again
+        current = Table();
+    }
+
+private:
+
+    Table m_last;
+    Parameters m_last_parameters;
+    bool m_last_valid;
+    std::vector<std::pair<Parameters, Table> > m_prepared;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_TABLE_CACHE_H_
@@ -0,0 +1,126 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+
+// Normal distribution restricted to [lower, upper], generated by inversion
+// (one 32-bit value per result, no rejection loops).
+template<class T>
+struct truncated_normal_distribution;
+
+template<>
+struct truncated_normal_distribution<float>
+{
+    const float mean;
+    const float stddev;
+    // Bounds of standard normal distribution
+    const float a;
+    const float b;
+
+    __host__ __device__
+    truncated_normal_distribution<float>(const float mean, const float stddev,
+                                         const float lower, const float upper) :
+                                         mean(mean), stddev(stddev),
+                                         a((lower - mean) / stddev),
+                                         b((upper - mean) / stddev) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int x) const
+    {
+        return mean + stddev * rocrand_device::detail::truncated_normal_distribution(x, a, b);
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 x) const
+    {
+        return float4 {
+            (*this)(x.x),
+            (*this)(x.y),
+            (*this)(x.z),
+            (*this)(x.w)
+        };
+    }
+};
+
+template<>
+struct truncated_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+    // Bounds of standard normal distribution
+    const double a;
+    const double b;
+
+    __host__ __device__
+    truncated_normal_distribution<double>(const double mean, const double stddev,
+                                          const double lower, const double upper) :
+                                          mean(mean), stddev(stddev),
+                                          a((lower - mean) / stddev),
+                                          b((upper - mean) / stddev) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x) const
+    {
+        return mean + stddev * rocrand_device::detail::truncated_normal_distribution_double(x, a, b);
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x, const unsigned int y) const
+    {
+        return mean + stddev * rocrand_device::detail::truncated_normal_distribution_double(x, y, a, b);
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 x) const
+    {
+        return double2 {
+            (*this)(x.x, x.y),
+            (*this)(x.z, x.w)
+        };
+    }
+};
+
+// MRG32k3a generates values in [1, ROCRAND_MRG32K3A_M1], they are scaled
+// to the full range of unsigned int first.
+template<class T>
+struct mrg_truncated_normal_distribution : truncated_normal_distribution<T>
+{
+    __host__ __device__
+    mrg_truncated_normal_distribution(const T mean, const T stddev,
+                                      const T lower, const T upper) :
+                                      truncated_normal_distribution<T>(mean, stddev, lower, upper) {}
+
+    __forceinline__ __host__ __device__
+    T operator()(const unsigned int x) const
+    {
+        return truncated_normal_distribution<T>::operator()(
+            static_cast<unsigned int>(x * ROCRAND_MRG32K3A_UINT_NORM)
+        );
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
@@ -24,7 +24,12 @@
 #include "distribution/uniform.hpp"
 #include "distribution/normal.hpp"
 #include "distribution/log_normal.hpp"
+#include "distribution/truncated_normal.hpp"
+#include "distribution/multivariate_normal.hpp"
+#include "distribution/brownian_bridge.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/binomial.hpp"
+#include "distribution/negative_binomial.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
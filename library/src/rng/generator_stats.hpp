@@ -0,0 +1,209 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_GENERATOR_STATS_H_
+#define ROCRAND_RNG_GENERATOR_STATS_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// Statistics of a generator (see rocrand_set_generator_stats).
+//
+// Counters are updated on the host, when statistics are disabled every
+// record_* call is a single branch. With ROCRAND_GENERATOR_STATS_TIMING
+// generate calls are timed by pairs of events recorded on the generator's
+// stream, the pairs are reused from a ring and a pair is synchronized only
+// when it is reused or statistics are queried.
+class generator_stats
+{
+public:
+    static const unsigned int timing_slots = 16;
+
+    generator_stats()
+        : m_mode(ROCRAND_GENERATOR_STATS_DISABLED), m_slot(0)
+    {
+        for(unsigned int i = 0; i < timing_slots; i++)
+        {
+            m_start[i] = NULL;
+            m_stop[i] = NULL;
+        }
+        reset();
+    }
+
+    ~generator_stats()
+    {
+        destroy_events();
+    }
+
+    rocrand_status set_mode(rocrand_generator_stats_mode mode)
+    {
+        if(mode != ROCRAND_GENERATOR_STATS_DISABLED
+            && mode != ROCRAND_GENERATOR_STATS_COUNTERS
+            && mode != ROCRAND_GENERATOR_STATS_TIMING)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        destroy_events();
+        m_mode = ROCRAND_GENERATOR_STATS_DISABLED;
+        reset();
+        if(mode == ROCRAND_GENERATOR_STATS_TIMING)
+        {
+            for(unsigned int i = 0; i < timing_slots; i++)
+            {
+                if(hipEventCreate(&m_start[i]) != hipSuccess
+                    || hipEventCreate(&m_stop[i]) != hipSuccess)
+                {
+                    destroy_events();
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+            }
+        }
+        m_mode = mode;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status get(rocrand_generator_stats * stats)
+    {
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        for(unsigned int i = 0; i < timing_slots; i++)
+        {
+            if(m_pending[i] && !read_slot(i))
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+        *stats = m_stats;
+        return status;
+    }
+
+    void record_launch()
+    {
+        if(m_mode != ROCRAND_GENERATOR_STATS_DISABLED)
+            m_stats.kernel_launches++;
+    }
+
+    void record_init()
+    {
+        if(m_mode != ROCRAND_GENERATOR_STATS_DISABLED)
+            m_stats.initializations++;
+    }
+
+    void record_table_build()
+    {
+        if(m_mode != ROCRAND_GENERATOR_STATS_DISABLED)
+            m_stats.table_builds++;
+    }
+
+    // Called before all work of a generate call is enqueued to stream
+    void begin_generate(hipStream_t stream)
+    {
+        if(m_mode != ROCRAND_GENERATOR_STATS_TIMING)
+            return;
+
+        if(m_pending[m_slot])
+        {
+            // Time of the oldest call is lost if its events can't be read
+            read_slot(m_slot);
+        }
+        m_started = hipEventRecord(m_start[m_slot], stream) == hipSuccess;
+    }
+
+    // Called after all work of a generate call of n numbers (counted
+    // in member numbers) is enqueued to stream, failed calls are not counted
+    void end_generate(hipStream_t stream,
+                      unsigned long long rocrand_generator_stats::* numbers,
+                      size_t n,
+                      bool succeeded)
+    {
+        if(m_mode == ROCRAND_GENERATOR_STATS_DISABLED || !succeeded)
+        {
+            m_started = false;
+            return;
+        }
+
+        m_stats.*numbers += n;
+        m_stats.generate_calls++;
+        if(m_mode == ROCRAND_GENERATOR_STATS_TIMING && m_started)
+        {
+            if(hipEventRecord(m_stop[m_slot], stream) == hipSuccess)
+            {
+                m_pending[m_slot] = true;
+                m_slot = (m_slot + 1) % timing_slots;
+            }
+            m_started = false;
+        }
+    }
+
+private:
+    void reset()
+    {
+        m_stats = rocrand_generator_stats();
+        m_slot = 0;
+        m_started = false;
+        for(unsigned int i = 0; i < timing_slots; i++)
+        {
+            m_pending[i] = false;
+        }
+    }
+
+    bool read_slot(unsigned int slot)
+    {
+        m_pending[slot] = false;
+        float elapsed;
+        if(hipEventSynchronize(m_stop[slot]) != hipSuccess
+            || hipEventElapsedTime(&elapsed, m_start[slot], m_stop[slot]) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return false;
+        }
+        m_stats.kernel_time_ms += elapsed;
+        return true;
+    }
+
+    void destroy_events()
+    {
+        for(unsigned int i = 0; i < timing_slots; i++)
+        {
+            if(m_start[i] != NULL)
+                (void)hipEventDestroy(m_start[i]);
+            if(m_stop[i] != NULL)
+                (void)hipEventDestroy(m_stop[i]);
+            m_start[i] = NULL;
+            m_stop[i] = NULL;
+        }
+    }
+
+    rocrand_generator_stats_mode m_mode;
+    rocrand_generator_stats m_stats;
+    hipEvent_t m_start[timing_slots];
+    hipEvent_t m_stop[timing_slots];
+    bool m_pending[timing_slots];
+    unsigned int m_slot;
+    bool m_started;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_GENERATOR_STATS_H_
@@ -24,14 +24,133 @@
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
+#include "generator_stats.hpp"
+#include "output_memory.hpp"
+#include "trace.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Returns the number of blocks of threads threads needed to process
+// work_items items (one item per thread), from 1 to max_blocks.
+//
+// Small requests launch only the first engines of a generator instead of
+// all of them, states of the other engines are not changed.
+inline unsigned int get_blocks(size_t work_items,
+                               unsigned int threads,
+                               unsigned int max_blocks)
+{
+    const size_t blocks = (work_items + threads - 1) / threads;
+    if(blocks == 0)
+        return 1;
+    return blocks < max_blocks ? static_cast<unsigned int>(blocks) : max_blocks;
+}
+
+// Launch parameters of a generate kernel: the number of blocks and
+// the stride, item i is processed by (logical) thread i % stride.
+struct generate_launch
+{
+    unsigned int blocks;
+    unsigned int stride;
+};
+
+// With ROCRAND_ORDERING_PSEUDO_PORTABLE the stride is always portable_threads,
+// so results do not depend on threads and max_blocks, the launched threads loop
+// over logical threads. Otherwise the stride is the number of launched threads.
+inline generate_launch get_generate_launch(rocrand_ordering order,
+                                           size_t work_items,
+                                           unsigned int threads,
+                                           unsigned int max_blocks,
+                                           unsigned int portable_threads)
+{
+    if(order == ROCRAND_ORDERING_PSEUDO_PORTABLE)
+    {
+        const size_t items = work_items < portable_threads ? work_items : portable_threads;
+        return { get_blocks(items, threads, max_blocks), portable_threads };
+    }
+    const unsigned int blocks = get_blocks(work_items, threads, max_blocks);
+    return { blocks, blocks * threads };
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 struct rocrand_generator_base_type
 {
     rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
     const rocrand_rng_type rng_type;
 
+    virtual hipStream_t get_stream() const = 0;
+
     virtual ~rocrand_generator_base_type() {}
+
+    // Statistics of the generator, disabled by default
+    rocrand_host::detail::generator_stats stats;
+};
+
+namespace rocrand_host {
+namespace detail {
+
+// Common part of generate functions of the C API, created after validation of
+// arguments (invalid calls are not traced): traces the call, replaces
+// output_data with the pointer used by kernels (see prepare_output_memory)
+// and records statistics: the events (if timing is enabled) surround all work
+// enqueued by the generator in the scope, numbers are counted only if done()
+// receives ROCRAND_STATUS_SUCCESS.
+class generate_scope
+{
+public:
+    template<class T>
+    generate_scope(const char * name,
+                   rocrand_generator generator,
+                   const char * distribution,
+                   unsigned long long rocrand_generator_stats::* numbers,
+                   T *& output_data,
+                   size_t n)
+        : m_trace(name, get_engine_name(generator->rng_type), distribution, n),
+          m_generator(generator), m_numbers(numbers), m_n(n), m_succeeded(false)
+    {
+        m_status = prepare_output_memory(output_data, n, m_generator->get_stream());
+        if(m_status == ROCRAND_STATUS_SUCCESS)
+        {
+            m_generator->stats.begin_generate(m_generator->get_stream());
+        }
+    }
+
+    ~generate_scope()
+    {
+        if(m_status == ROCRAND_STATUS_SUCCESS)
+        {
+            m_generator->stats.end_generate(
+                m_generator->get_stream(), m_numbers, m_n, m_succeeded
+            );
+        }
+    }
+
+    // Result of preparation of the output memory
+    rocrand_status status() const
+    {
+        return m_status;
+    }
+
+    rocrand_status done(rocrand_status status)
+    {
+        m_succeeded = status == ROCRAND_STATUS_SUCCESS;
+        return status;
+    }
+
+private:
+    trace_scope m_trace;
+    rocrand_generator m_generator;
+    unsigned long long rocrand_generator_stats::* m_numbers;
+    size_t m_n;
+    bool m_succeeded;
+    rocrand_status m_status;
 };
 
+} // end namespace detail
+} // end namespace rocrand_host
+
 // rocRAND random number generator base class
 template<rocrand_rng_type GeneratorType = ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
 struct rocrand_generator_type : public rocrand_generator_base_type
@@ -42,6 +161,11 @@ struct rocrand_generator_type : public rocrand_generator_base_type
                            unsigned long long offset = 0,
                            hipStream_t stream = 0)
         : base_type(GeneratorType),
+          m_order(
+              GeneratorType == ROCRAND_RNG_QUASI_SOBOL32
+                  ? ROCRAND_ORDERING_QUASI_DEFAULT
+                  : ROCRAND_ORDERING_PSEUDO_DEFAULT
+          ),
           m_seed(seed), m_offset(offset), m_stream(stream)
     {
 
@@ -53,6 +177,11 @@ struct rocrand_generator_type : public rocrand_generator_base_type
         return rng_type;
     }
 
+    rocrand_ordering get_order() const
+    {
+        return m_order;
+    }
+
     unsigned long long get_seed() const
     {
         return m_seed;
@@ -74,7 +203,25 @@ struct rocrand_generator_type : public rocrand_generator_base_type
     }
 
 protected:
+    // Keeps tables of a distribution for the parameters args
+    // (used by rocrand_prepare_*() functions)
+    template<class Manager, class... Args>
+    rocrand_status prepare_table(Manager& manager, Args... args)
+    {
+        try
+        {
+            if(manager.prepare(args...))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     // ordering type
+    rocrand_ordering m_order;
     unsigned long long m_seed;
     unsigned long long m_offset;
     hipStream_t m_stream;
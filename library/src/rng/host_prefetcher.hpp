@@ -0,0 +1,195 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_HOST_PREFETCHER_H_
+#define ROCRAND_RNG_HOST_PREFETCHER_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+
+// Delivers random numbers to host memory with two pinned buffers: while
+// the host reads one buffer, the next one is generated on the generator's
+// stream and copied to the other buffer on a separate copy stream, so
+// generation of buffer k + 1 overlaps the device-to-host copy of buffer k.
+struct rocrand_host_prefetcher_type
+{
+    rocrand_host_prefetcher_type(rocrand_generator generator,
+                                 rocrand_prefetch_type type,
+                                 size_t size)
+        : generator(generator), type(type), size(size),
+          current(0), started(false), copy_stream(NULL)
+    {
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            device_buffers[i] = NULL;
+            host_buffers[i] = NULL;
+            generated[i] = NULL;
+            copied[i] = NULL;
+        }
+
+        const size_t bytes = size * get_value_size(type);
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            if(hipMalloc(&device_buffers[i], bytes) != hipSuccess
+               || hipHostMalloc(&host_buffers[i], bytes) != hipSuccess)
+            {
+                deallocate();
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(hipEventCreateWithFlags(&generated[i], hipEventDisableTiming) != hipSuccess
+               || hipEventCreateWithFlags(&copied[i], hipEventDisableTiming) != hipSuccess)
+            {
+                deallocate();
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+        if(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking) != hipSuccess)
+        {
+            deallocate();
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    ~rocrand_host_prefetcher_type()
+    {
+        // Buffers may be used by pending copies
+        if(copy_stream != NULL)
+            hipStreamSynchronize(copy_stream);
+        deallocate();
+    }
+
+    static size_t get_value_size(rocrand_prefetch_type type)
+    {
+        if(type == ROCRAND_PREFETCH_UNIFORM_DOUBLE || type == ROCRAND_PREFETCH_NORMAL_DOUBLE)
+            return sizeof(double);
+        return sizeof(unsigned int);
+    }
+
+    // Returns the host buffer with the next size values, the previous
+    // buffer is reused for prefetching.
+    rocrand_status next(const void ** output)
+    {
+        rocrand_status status;
+        if(!started)
+        {
+            // Both buffers are in flight
+            status = fill(0);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            status = fill(1);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            started = true;
+        }
+        else
+        {
+            // The host does not use the previous buffer anymore
+            status = fill(current ^ 1);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
+        if(hipEventSynchronize(copied[current]) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        *output = host_buffers[current];
+        current ^= 1;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+    // Generates values into the device buffer i on the generator's stream
+    // and copies them to the host buffer i on the copy stream
+    rocrand_status fill(unsigned int i)
+    {
+        const hipStream_t stream = generator->get_stream();
+
+        // The device buffer can be reused when its previous copy is finished
+        if(hipStreamWaitEvent(stream, copied[i], 0) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        rocrand_status status = generate(device_buffers[i]);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(hipEventRecord(generated[i], stream) != hipSuccess
+           || hipStreamWaitEvent(copy_stream, generated[i], 0) != hipSuccess
+           || hipMemcpyAsync(host_buffers[i], device_buffers[i], size * get_value_size(type),
+                             hipMemcpyDeviceToHost, copy_stream) != hipSuccess
+           || hipEventRecord(copied[i], copy_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate(void * data)
+    {
+        switch(type)
+        {
+            case ROCRAND_PREFETCH_UINT:
+                return rocrand_generate(generator, static_cast<unsigned int *>(data), size);
+            case ROCRAND_PREFETCH_UNIFORM_FLOAT:
+                return rocrand_generate_uniform(generator, static_cast<float *>(data), size);
+            case ROCRAND_PREFETCH_UNIFORM_DOUBLE:
+                return rocrand_generate_uniform_double(generator, static_cast<double *>(data), size);
+            case ROCRAND_PREFETCH_NORMAL_FLOAT:
+                return rocrand_generate_normal(generator, static_cast<float *>(data), size, 0.0f, 1.0f);
+            case ROCRAND_PREFETCH_NORMAL_DOUBLE:
+                return rocrand_generate_normal_double(generator, static_cast<double *>(data), size, 0.0, 1.0);
+        }
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    void deallocate()
+    {
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            if(device_buffers[i] != NULL)
+                hipFree(device_buffers[i]);
+            if(host_buffers[i] != NULL)
+                hipHostFree(host_buffers[i]);
+            if(generated[i] != NULL)
+                hipEventDestroy(generated[i]);
+            if(copied[i] != NULL)
+                hipEventDestroy(copied[i]);
+        }
+        if(copy_stream != NULL)
+            hipStreamDestroy(copy_stream);
+    }
+
+    rocrand_generator generator;
+    const rocrand_prefetch_type type;
+    const size_t size;
+
+    // Index of the buffer which is returned by the next call of next()
+    unsigned int current;
+    bool started;
+
+    void * device_buffers[2];
+    void * host_buffers[2];
+    hipEvent_t generated[2];
+    hipEvent_t copied[2];
+    hipStream_t copy_stream;
+};
+
+#endif // ROCRAND_RNG_HOST_PREFETCHER_H_
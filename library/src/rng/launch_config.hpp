@@ -0,0 +1,128 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_LAUNCH_CONFIG_H_
+#define ROCRAND_RNG_LAUNCH_CONFIG_H_
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <hip/hip_runtime.h>
+
+// Name of the environment variable with path to the tuning file.
+//
+// Each line of the tuning file (except empty lines and lines starting with #)
+// is an entry:
+// <engine> <threads per block> <blocks> <device name>
+// for example:
+// philox 256 1024 Vega 20
+//
+// Generators created on the device with the given name use the entry
+// of their engine instead of default launch parameters.
+// Entries with invalid parameters are ignored. If there are several entries for
+// the same engine and device, the last one is used.
+#define ROCRAND_TUNING_FILE_ENV "ROCRAND_TUNING_FILE"
+
+namespace rocrand_host {
+namespace detail {
+
+struct launch_config
+{
+    unsigned int threads;
+    unsigned int blocks;
+};
+
+// Constraints of launch parameters of a generator
+struct launch_config_limits
+{
+    unsigned int max_threads;
+    unsigned int threads_multiple;
+    unsigned int max_blocks;
+    unsigned int blocks_multiple;
+};
+
+inline bool is_valid_launch_config(const launch_config& config,
+                                   const launch_config_limits& limits)
+{
+    return config.threads > 0 && config.threads <= limits.max_threads
+        && config.threads % limits.threads_multiple == 0
+        && config.blocks > 0 && config.blocks <= limits.max_blocks
+        && config.blocks % limits.blocks_multiple == 0;
+}
+
+// Returns name of the current device which is used as a key of tuning entries
+inline std::string get_device_name()
+{
+    int device_id;
+    hipDeviceProp_t props;
+    if(hipGetDevice(&device_id) != hipSuccess
+       || hipGetDeviceProperties(&props, device_id) != hipSuccess)
+    {
+        return std::string();
+    }
+    return std::string(props.name);
+}
+
+// Returns launch parameters of engine for the current device from the tuning
+// file (see ROCRAND_TUNING_FILE_ENV) or default_config if there is no valid entry
+inline launch_config get_launch_config(const std::string& engine,
+                                       const launch_config& default_config,
+                                       const launch_config_limits& limits)
+{
+    const char * path = std::getenv(ROCRAND_TUNING_FILE_ENV);
+    if(path == NULL || path[0] == '\0')
+        return default_config;
+
+    std::ifstream file(path);
+    if(!file)
+        return default_config;
+
+    const std::string device_name = get_device_name();
+    launch_config config = default_config;
+    std::string line;
+    while(std::getline(file, line))
+    {
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream entry(line);
+        std::string entry_engine;
+        launch_config entry_config;
+        std::string entry_device_name;
+        if(!(entry >> entry_engine >> entry_config.threads >> entry_config.blocks))
+            continue;
+        std::getline(entry >> std::ws, entry_device_name);
+        // Remove trailing whitespace (e.g. \r)
+        entry_device_name.erase(entry_device_name.find_last_not_of(" \t\r") + 1);
+
+        if(entry_engine == engine && entry_device_name == device_name
+           && is_valid_launch_config(entry_config, limits))
+        {
+            config = entry_config;
+        }
+    }
+    return config;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_LAUNCH_CONFIG_H_
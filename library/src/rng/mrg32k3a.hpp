@@ -28,80 +28,210 @@
 #include <rocrand_mrg32k3a_precomputed.h>
 
 #include "generator_type.hpp"
+#include "launch_config.hpp"
 #include "device_engines.hpp"
+#include "soa_engines.hpp"
 #include "distributions.hpp"
+#include "vector_types.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
     typedef ::rocrand_device::mrg32k3a_engine mrg32k3a_device_engine;
 
+    // Generate kernels load and save only the MRG32k3a state (see device_engines.hpp)
+    static_assert(sizeof(mrg32k3a_device_engine) == 6 * sizeof(unsigned int),
+                  "MRG32k3a engines of host generators must not contain Box-Muller state");
+
     __global__
-    void init_engines_kernel(mrg32k3a_device_engine * engines,
+    void init_engines_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                            const unsigned int engines_size,
                             unsigned long long seed,
                             unsigned long long offset)
     {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = mrg32k3a_device_engine(seed, engine_id, offset);
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < engines_size;
+            engine_id += stride)
+        {
+            engines.save(engine_id, mrg32k3a_device_engine(seed, engine_id, offset));
+        }
     }
 
-    template<class Type, class Distribution>
-    __global__
-    void generate_kernel(mrg32k3a_device_engine * engines,
-                         Type * data, const size_t n,
-                         const Distribution distribution)
-    {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int index = engine_id;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    // In all generate kernels number (or vector, or pair) with index i is
+    // generated by engine i % stride. If stride is greater than the number
+    // of launched threads, each thread processes several engines.
 
-        // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
+    template<class Type4, class Distribution>
+    __forceinline__ __device__
+    Type4 generate_vector4(mrg32k3a_device_engine& engine,
+                           const Distribution& distribution)
+    {
+        Type4 result;
+        result.x = distribution(engine());
+        result.y = distribution(engine());
+        result.z = distribution(engine());
+        result.w = distribution(engine());
+        return result;
+    }
 
+    // Each engine produces and saves one value per iteration, it is used for
+    // ROCRAND_ORDERING_PSEUDO_PORTABLE so number i is generated by engine i % stride
+    template<class Type, class Distribution>
+    __forceinline__ __device__
+    void generate_scalar_values(mrg32k3a_device_engine& engine,
+                                const unsigned int engine_id,
+                                const unsigned int stride,
+                                Type * data, const size_t n,
+                                const Distribution& distribution)
+    {
+        size_t index = engine_id;
         while(index < n)
         {
             data[index] = distribution(engine());
             // Next position
             index += stride;
         }
+    }
 
-        // Save engine with its state
-        engines[engine_id] = engine;
+    // If vectorized, each engine produces 4 values per iteration and saves them
+    // with vector stores (scalar stores if data is not aligned to the vector
+    // size, the mapping of values to engines does not depend on alignment).
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                         const unsigned int stride,
+                         Type * data, const size_t n,
+                         const Distribution distribution,
+                         const bool vectorized)
+    {
+        typedef typename vector4_type<Type>::type Type4;
+        typedef typename unaligned_type<Type4>::type Type4_unaligned;
+
+        const size_t work_items = vectorized ? (n + 3) / 4 : n;
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride && engine_id < work_items;
+            engine_id += grid_size)
+        {
+            unsigned int index = engine_id;
+
+            // Load device engine
+            mrg32k3a_device_engine engine = engines.load(engine_id);
+
+            if(!vectorized)
+            {
+                generate_scalar_values(engine, engine_id, stride, data, n, distribution);
+            }
+            else if(((uintptr_t)data)%(sizeof(Type4)) == 0)
+            {
+                Type4 * data4 = (Type4 *)data;
+                while(index < (n / 4))
+                {
+                    data4[index] = generate_vector4<Type4>(engine, distribution);
+                    // Next position
+                    index += stride;
+                }
+            }
+            else
+            {
+                Type4_unaligned * data4 = (Type4_unaligned *)data;
+                while(index < (n / 4))
+                {
+                    Type4 result = generate_vector4<Type4>(engine, distribution);
+                    data4[index] = *(Type4_unaligned*)(&result);  // reinterpret as Type4_unaligned
+                    // Next position
+                    index += stride;
+                }
+            }
+
+            // Save the tail (last 1, 2, 3 values) by the engine which would
+            // save the next vector if n was a multiple of 4
+            const size_t tail_size = n & 3;
+            if(vectorized && index == (n / 4) && tail_size > 0)
+            {
+                Type4 result = generate_vector4<Type4>(engine, distribution);
+                data[n - tail_size] = result.x;
+                if(tail_size > 1) data[n - tail_size + 1] = result.y;
+                if(tail_size > 2) data[n - tail_size + 2] = result.z;
+            }
+
+            // Save engine with its state
+            engines.save(engine_id, engine);
+        }
     }
 
     template<class RealType, class Distribution>
     __global__
-    void generate_normal_kernel(mrg32k3a_device_engine * engines,
+    void generate_normal_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                const unsigned int stride,
                                 RealType * data, const size_t n,
                                 Distribution distribution)
     {
-        typedef decltype(distribution(engines->next(), engines->next())) RealType2;
-
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int index = engine_id;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
-
-        RealType2 * data2 = (RealType2 *)data;
-        while(index < (n / 2))
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        // Engine 0 also generates the tail
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride && (engine_id < (n / 2) || engine_id == 0);
+            engine_id += grid_size)
         {
-            data2[index] = distribution(engine(), engine());
-            // Next position
-            index += stride;
+            unsigned int index = engine_id;
+
+            // Load device engine
+            mrg32k3a_device_engine engine = engines.load(engine_id);
+            typedef decltype(distribution(engine.next(), engine.next())) RealType2;
+
+            RealType2 * data2 = (RealType2 *)data;
+            while(index < (n / 2))
+            {
+                data2[index] = distribution(engine(), engine());
+                // Next position
+                index += stride;
+            }
+
+            // First work-item saves the tail when n is not a multiple of 2
+            if(engine_id == 0 && (n & 1) > 0)
+            {
+                RealType2 result = distribution(engine(), engine());
+                // Save the tail
+                data[n - 1] = result.x;
+            }
+
+            // Save engine with its state
+            engines.save(engine_id, engine);
         }
+    }
+
+    template<unsigned int MaxDimensions, class RealType>
+    __global__
+    void generate_multivariate_normal_kernel(soa_engines<mrg32k3a_device_engine> engines,
+                                             const unsigned int stride,
+                                             RealType * data, const size_t n_vectors,
+                                             const multivariate_normal_distribution<RealType> distribution)
+    {
+        __shared__ multivariate_normal_shared_data<RealType, MaxDimensions> shared;
+        distribution.load(shared);
 
-        // First work-item saves the tail when n is not a multiple of 2
-        if(engine_id == 0 && (n & 1) > 0)
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride && engine_id < n_vectors;
+            engine_id += grid_size)
         {
-            RealType2 result = distribution(engine(), engine());
-            // Save the tail
-            data[n - 1] = result.x;
-        }
+            unsigned int index = engine_id;
+
+            // Load device engine
+            mrg32k3a_device_engine engine = engines.load(engine_id);
+            mrg_normal2_generator<RealType, mrg32k3a_device_engine> normal2(engine);
 
-        // Save engine with its state
-        engines[engine_id] = engine;
+            while(index < n_vectors)
+            {
+                distribution(shared, data + static_cast<size_t>(index) * distribution.dimensions, normal2);
+                // Next position
+                index += stride;
+            }
+
+            // Save engine with its state
+            engines.save(engine_id, engine);
+        }
     }
 
 } // end namespace detail
@@ -117,10 +247,16 @@ public:
                      unsigned long long offset = 0,
                      hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_threads * s_blocks)
+          m_engines_initialized(false),
+          m_config(
+              rocrand_host::detail::get_launch_config(
+                  "mrg32k3a", { s_threads, s_blocks }, { 1024, 32, 65535, 1 }
+              )
+          ),
+          m_engines_size(m_config.threads * m_config.blocks)
     {
         // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        auto error = m_engines.allocate(m_engines_size);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -133,7 +269,7 @@ public:
 
     ~rocrand_mrg32k3a()
     {
-        hipFree(m_engines);
+        m_engines.deallocate();
     }
 
     void reset()
@@ -161,20 +297,49 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Changes ordering of results to \p order and resets generator state.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        const size_t engines_size = get_engines_size(order);
+        if(engines_size != m_engines_size)
+        {
+            rocrand_host::detail::soa_engines<engine_type> engines;
+            auto error = engines.allocate(engines_size);
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            m_engines.deallocate();
+            m_engines = engines;
+            m_engines_size = engines_size;
+        }
+        m_order = order;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        rocrand_host::detail::trace_scope trace(
+            "rocrand_init", rocrand_host::detail::get_engine_name(rng_type)
+        );
+
+        const unsigned int blocks =
+            rocrand_host::detail::get_blocks(m_engines_size, m_config.threads, m_config.blocks);
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), m_seed, m_offset
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
+        stats.record_init();
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -188,14 +353,23 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        // Vector stores map groups of 4 values to engines, the portable ordering
+        // keeps its documented mapping of single values
+        const bool vectorized = m_order != ROCRAND_ORDERING_PSEUDO_PORTABLE;
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, vectorized ? (data_size + 3) / 4 : data_size,
+                m_config.threads, m_config.blocks, s_portable_engines
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, distribution, vectorized
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -223,14 +397,19 @@ public:
 
         mrg_normal_distribution<T> distribution(mean, stddev);
 
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, data_size / 2, m_config.threads, m_config.blocks, s_portable_engines
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -251,35 +430,160 @@ public:
 
         mrg_log_normal_distribution<T> distribution(mean, stddev);
 
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, data_size / 2, m_config.threads, m_config.blocks, s_portable_engines
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lower, T upper)
+    {
+        mrg_truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+        return generate(data, data_size, distribution);
+    }
+
+    template<unsigned int MaxDimensions, class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t n_vectors,
+                                                const multivariate_normal_distribution<T>& distribution)
+    {
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, n_vectors, m_config.threads, m_config.blocks, s_portable_engines
+            );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel<MaxDimensions>),
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, n_vectors, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        multivariate_normal_distribution<T> distribution(mean, factor, dimensions);
+
+        // Use the smallest kernel which fits dimensions (less registers and shared memory)
+        if(dimensions <= 4)
+            return generate_multivariate_normal<4>(data, n_vectors, distribution);
+        else if(dimensions <= 8)
+            return generate_multivariate_normal<8>(data, n_vectors, distribution);
+        else if(dimensions <= 16)
+            return generate_multivariate_normal<16>(data, n_vectors, distribution);
+        return generate_multivariate_normal<ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS>(data, n_vectors, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            if(m_poisson.set_lambda(lambda, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis());
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double probability)
+    {
+        try
+        {
+            if(m_binomial.set_parameters(trials, probability, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_binomial.dis());
+    }
+
+    rocrand_status generate_negative_binomial(unsigned int * data, size_t data_size,
+                                              double successes, double probability)
+    {
+        try
+        {
+            if(m_negative_binomial.set_parameters(successes, probability, m_stream))
+                stats.record_table_build();
         }
         catch(rocrand_status status)
         {
             return status;
         }
-        return generate(data, data_size, m_poisson.dis);
+        return generate(data, data_size, m_negative_binomial.dis());
+    }
+
+    rocrand_status prepare_poisson(double lambda)
+    {
+        return prepare_table(m_poisson, lambda);
+    }
+
+    rocrand_status prepare_binomial(unsigned int trials, double probability)
+    {
+        return prepare_table(m_binomial, trials, probability);
+    }
+
+    rocrand_status prepare_negative_binomial(double successes, double probability)
+    {
+        return prepare_table(m_negative_binomial, successes, probability);
+    }
+
+    rocrand_status release_prepared_tables()
+    {
+        // Freeing memory used by a graph being captured invalidates the capture
+        if(rocrand_host::detail::is_capturing(m_stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        m_poisson.release_prepared();
+        m_binomial.release_prepared();
+        m_negative_binomial.release_prepared();
+        return ROCRAND_STATUS_SUCCESS;
     }
 
 private:
+    // Number of engines required for ordering order
+    size_t get_engines_size(rocrand_ordering order) const
+    {
+        const size_t engines_size = m_config.threads * m_config.blocks;
+        if(order == ROCRAND_ORDERING_PSEUDO_PORTABLE)
+            return std::max<size_t>(engines_size, s_portable_engines);
+        return engines_size;
+    }
+
     bool m_engines_initialized;
-    engine_type * m_engines;
+    // Engines are stored as a structure of arrays for coalesced accesses
+    rocrand_host::detail::soa_engines<engine_type> m_engines;
+    // Launch parameters (from the tuning file or default)
+    const rocrand_host::detail::launch_config m_config;
     size_t m_engines_size;
+    // Default launch parameters
     #ifdef __HIP_PLATFORM_NVCC__
     static const uint32_t s_threads = 128;
     static const uint32_t s_blocks = 128;
@@ -287,9 +591,15 @@ private:
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
     #endif
+    // Number of engines (stride) with ROCRAND_ORDERING_PSEUDO_PORTABLE,
+    // it is equal to the number of threads with the default launch parameters of HCC
+    static const uint32_t s_portable_engines = 256 * 512;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    // For caching of binomial and negative binomial tables
+    binomial_distribution_manager<> m_binomial;
+    negative_binomial_distribution_manager<> m_negative_binomial;
 
     // m_seed from base_type
     // m_offset from base_type
@@ -62,8 +62,10 @@
 #include <rocrand_mtgp32_11213.h>
 
 #include "generator_type.hpp"
+#include "launch_config.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "stream_capture.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -71,40 +73,94 @@ namespace detail {
     typedef ::rocrand_device::mtgp32_engine mtgp32_device_engine;
     typedef ::rocrand_device::mtgp32_state mtgp32_state;
 
+    // In all generate kernels numbers (or vectors) with indices from i * hipBlockDim_x
+    // to (i + 1) * hipBlockDim_x - 1 are generated by engine i % engines_stride.
+    // If engines_stride is greater than the number of launched blocks, each
+    // block processes several engines.
+
     template<class Type, class Distribution>
     __global__
     void generate_kernel(mtgp32_device_engine * engines,
+                         const unsigned int engines_stride,
                          Type * data,
                          const size_t size,
                          const size_t size_up, // size rounded up to the nearest multiple of hipBlockDim_x
                          const size_t size_down, // size rounded down to the nearest multiple of hipBlockDim_x
                          Distribution distribution)
     {
-        const unsigned int engine_id = hipBlockIdx_x;
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        const unsigned int stride = engines_stride * hipBlockDim_x;
 
-        // Load device engine
         __shared__ mtgp32_device_engine engine;
-        engine.copy(&engines[engine_id]);
 
-        while(index < size_down)
+        for(unsigned int engine_id = hipBlockIdx_x;
+            engine_id < engines_stride && engine_id * hipBlockDim_x < size;
+            engine_id += hipGridDim_x)
         {
-            data[index] = distribution(engine());
-            // Next position
-            index += stride;
+            unsigned int index = engine_id * hipBlockDim_x + hipThreadIdx_x;
+
+            // Load device engine
+            engine.copy(&engines[engine_id]);
+
+            while(index < size_down)
+            {
+                data[index] = distribution(engine());
+                // Next position
+                index += stride;
+            }
+            while(index < size_up)
+            {
+                auto value = distribution(engine());
+                if(index < size)
+                    data[index] = value;
+                // Next position
+                index += stride;
+            }
+
+            // Save engine with its state
+            engines[engine_id].copy(&engine);
         }
-        while(index < size_up)
+    }
+
+    template<unsigned int MaxDimensions, class RealType>
+    __global__
+    void generate_multivariate_normal_kernel(mtgp32_device_engine * engines,
+                                             const unsigned int engines_stride,
+                                             RealType * data,
+                                             const size_t n_vectors,
+                                             const size_t n_vectors_up, // n_vectors rounded up to the nearest multiple of hipBlockDim_x
+                                             const multivariate_normal_distribution<RealType> distribution)
+    {
+        __shared__ multivariate_normal_shared_data<RealType, MaxDimensions> shared;
+        distribution.load(shared);
+
+        const unsigned int stride = engines_stride * hipBlockDim_x;
+
+        __shared__ mtgp32_device_engine engine;
+
+        for(unsigned int engine_id = hipBlockIdx_x;
+            engine_id < engines_stride && engine_id * hipBlockDim_x < n_vectors;
+            engine_id += hipGridDim_x)
         {
-            auto value = distribution(engine());
-            if(index < size)
-                data[index] = value;
-            // Next position
-            index += stride;
+            unsigned int index = engine_id * hipBlockDim_x + hipThreadIdx_x;
+
+            // Load device engine
+            engine.copy(&engines[engine_id]);
+            normal2_generator<RealType, mtgp32_device_engine> normal2(engine);
+
+            // All threads of the block must generate the same number of values
+            while(index < n_vectors_up)
+            {
+                RealType * output = index < n_vectors
+                    ? data + static_cast<size_t>(index) * distribution.dimensions
+                    : NULL;
+                distribution(shared, output, normal2);
+                // Next position
+                index += stride;
+            }
+
+            // Save engine with its state
+            engines[engine_id].copy(&engine);
         }
-
-        // Save engine with its state
-        engines[engine_id].copy(&engine);
     }
 
 } // end namespace detail
@@ -120,7 +176,13 @@ public:
                    unsigned long long offset = 0,
                    hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_blocks)
+          m_engines_initialized(false), m_engines(NULL),
+          m_config(
+              rocrand_host::detail::get_launch_config(
+                  "mtgp32", { s_threads, s_blocks }, { s_threads, s_threads, MTGP_BN_MAX, 1 }
+              )
+          ),
+          m_engines_size(m_config.blocks)
     {
         // Allocate device random number engines
         auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
@@ -156,17 +218,47 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Changes ordering of results to \p order and resets generator state.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        const size_t engines_size = get_engines_size(order);
+        if(engines_size != m_engines_size)
+        {
+            engine_type * engines = NULL;
+            auto error = hipMalloc(&engines, sizeof(engine_type) * engines_size);
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            hipFree(m_engines);
+            m_engines = engines;
+            m_engines_size = engines_size;
+        }
+        m_order = order;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        rocrand_host::detail::trace_scope trace(
+            "rocrand_init", rocrand_host::detail::get_engine_name(rng_type)
+        );
+
+        // States are created on the host and copied synchronously
+        if(rocrand_host::detail::is_capturing(m_stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
         rocrand_status status;
 
         status = rocrand_make_state_mtgp32(m_engines, mtgp32dc_params_fast_11213, m_engines_size, m_seed);
         if(status != ROCRAND_STATUS_SUCCESS)
             return ROCRAND_STATUS_ALLOCATION_FAILED;
 
+        stats.record_init();
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -187,15 +279,20 @@ public:
         const size_t size_rounded_up =
             remainder_value == 0 ? data_size : size_rounded_down + s_threads;
 
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, data_size, s_threads, m_config.blocks, s_portable_engines * s_threads
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, size_rounded_up,
+            dim3(launch.blocks), dim3(s_threads), 0, m_stream,
+            m_engines, launch.stride / s_threads, data, data_size, size_rounded_up,
             size_rounded_down, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -221,23 +318,145 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lower, T upper)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+        return generate(data, data_size, distribution);
+    }
+
+    template<unsigned int MaxDimensions, class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t n_vectors,
+                                                const multivariate_normal_distribution<T>& distribution)
+    {
+        const size_t remainder_value = n_vectors%s_threads;
+        const size_t n_vectors_rounded_up =
+            remainder_value == 0 ? n_vectors : n_vectors - remainder_value + s_threads;
+
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, n_vectors, s_threads, m_config.blocks, s_portable_engines * s_threads
+            );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel<MaxDimensions>),
+            dim3(launch.blocks), dim3(s_threads), 0, m_stream,
+            m_engines, launch.stride / s_threads, data, n_vectors, n_vectors_rounded_up, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        multivariate_normal_distribution<T> distribution(mean, factor, dimensions);
+
+        // Use the smallest kernel which fits dimensions (less registers and shared memory)
+        if(dimensions <= 4)
+            return generate_multivariate_normal<4>(data, n_vectors, distribution);
+        else if(dimensions <= 8)
+            return generate_multivariate_normal<8>(data, n_vectors, distribution);
+        else if(dimensions <= 16)
+            return generate_multivariate_normal<16>(data, n_vectors, distribution);
+        return generate_multivariate_normal<ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS>(data, n_vectors, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            if(m_poisson.set_lambda(lambda, m_stream))
+                stats.record_table_build();
         }
         catch(rocrand_status status)
         {
             return status;
         }
-        return generate(data, data_size, m_poisson.dis);
+        return generate(data, data_size, m_poisson.dis());
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double probability)
+    {
+        try
+        {
+            if(m_binomial.set_parameters(trials, probability, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_binomial.dis());
+    }
+
+    rocrand_status generate_negative_binomial(unsigned int * data, size_t data_size,
+                                              double successes, double probability)
+    {
+        try
+        {
+            if(m_negative_binomial.set_parameters(successes, probability, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_negative_binomial.dis());
+    }
+
+    rocrand_status prepare_poisson(double lambda)
+    {
+        return prepare_table(m_poisson, lambda);
+    }
+
+    rocrand_status prepare_binomial(unsigned int trials, double probability)
+    {
+        return prepare_table(m_binomial, trials, probability);
+    }
+
+    rocrand_status prepare_negative_binomial(double successes, double probability)
+    {
+        return prepare_table(m_negative_binomial, successes, probability);
+    }
+
+    rocrand_status release_prepared_tables()
+    {
+        // Freeing memory used by a graph being captured invalidates the capture
+        if(rocrand_host::detail::is_capturing(m_stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        m_poisson.release_prepared();
+        m_binomial.release_prepared();
+        m_negative_binomial.release_prepared();
+        return ROCRAND_STATUS_SUCCESS;
     }
 
 private:
+    // Number of engines required for ordering order
+    size_t get_engines_size(rocrand_ordering order) const
+    {
+        if(order == ROCRAND_ORDERING_PSEUDO_PORTABLE)
+            return std::max<size_t>(m_config.blocks, s_portable_engines);
+        return m_config.blocks;
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
+    // Launch parameters (from the tuning file or default)
+    const rocrand_host::detail::launch_config m_config;
     size_t m_engines_size;
+    // Default launch parameters
     #ifdef __HIP_PLATFORM_NVCC__
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 64;
@@ -245,9 +464,15 @@ private:
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
     #endif
+    // Number of engines (stride in blocks) with ROCRAND_ORDERING_PSEUDO_PORTABLE,
+    // it is equal to the number of blocks with the default launch parameters of HCC
+    static const uint32_t s_portable_engines = MTGP_BN_MAX;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    // For caching of binomial and negative binomial tables
+    binomial_distribution_manager<> m_binomial;
+    negative_binomial_distribution_manager<> m_negative_binomial;
 
     // m_seed from base_type
     // m_offset from base_type
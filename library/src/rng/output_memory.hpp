@@ -0,0 +1,103 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_OUTPUT_MEMORY_H_
+#define ROCRAND_RNG_OUTPUT_MEMORY_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// Replaces data with a pointer which kernels of the generator use to store
+// size values to memory referenced by data:
+// - device memory is written directly;
+// - pinned host memory (hipHostMalloc, hipHostRegister) is written through
+//   its device mapping (zero-copy), so callers do not need a device buffer and
+//   a copy to host;
+// - managed memory (hipMallocManaged) is prefetched to the current device on
+//   the generator's stream, so kernels do not fault on pages which are
+//   resident on host;
+// - other pointers (e.g. pageable host memory on systems which support it)
+//   are used unchanged.
+//
+// Attributes are queried on every call: a buffer can be freed and another
+// kind of memory can be allocated at the same address, and the query is cheap
+// compared with a kernel launch.
+template<class T>
+inline rocrand_status prepare_output_memory(T *& data, size_t size, hipStream_t stream)
+{
+    if(data == NULL || size == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // hipPointerGetAttributes fails for memory unknown to HIP and sets
+    // the last error, it must not replace an error of the caller's previous
+    // HIP calls which is not retrieved yet (data is used unchanged)
+    if(hipPeekAtLastError() != hipSuccess)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, data) != hipSuccess)
+    {
+        // Memory is not allocated or registered by HIP, the error
+        // is set by the call above
+        (void)hipGetLastError();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    if(attributes.isManaged)
+    {
+#if defined(HIP_VERSION) && HIP_VERSION >= 40000000
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        // Prefetching is only a hint, it is not supported by all devices
+        if(hipMemPrefetchAsync(data, size * sizeof(T), device, stream) != hipSuccess)
+        {
+            (void)hipGetLastError();
+        }
+#else
+        (void)stream;
+#endif
+    }
+    else if(attributes.memoryType == hipMemoryTypeHost)
+    {
+        if(attributes.devicePointer == NULL)
+        {
+            // Kernels can't access host memory which is not mapped
+            // to the device's address space
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        data = static_cast<T *>(attributes.devicePointer);
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_OUTPUT_MEMORY_H_
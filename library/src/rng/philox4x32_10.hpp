@@ -59,72 +59,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <rocrand.h>
 
 #include "generator_type.hpp"
+#include "launch_config.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "vector_types.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
-    struct double2_unaligned
-    {
-        double x;
-        double y;
-    };
-
-    struct uint4_unaligned
-    {
-        unsigned int x;
-        unsigned int y;
-        unsigned int z;
-        unsigned int w;
-    };
-
-    struct float4_unaligned
-    {
-        float x;
-        float y;
-        float z;
-        float w;
-    };
-
-    struct double4_unaligned
-    {
-        double x;
-        double y;
-        double z;
-        double w;
-    };
-
-    template<class T>
-    struct unaligned_type
-    {
-        typedef void type;
-    };
-
-    template<>
-    struct unaligned_type<double2>
-    {
-        typedef double2_unaligned type;
-    };
-
-    template<>
-    struct unaligned_type<uint4>
-    {
-        typedef uint4_unaligned type;
-    };
-
-    template<>
-    struct unaligned_type<float4>
-    {
-        typedef float4_unaligned type;
-    };
-
-    template<>
-    struct unaligned_type<double4>
-    {
-        typedef double4_unaligned type;
-    };
-
     inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
       for (int offset = size/2; offset > 0; offset /= 2) {
         #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
@@ -171,16 +113,38 @@ namespace detail {
 
     __global__
     void init_engines_kernel(philox4x32_10_device_engine * engines,
+                             const unsigned int engines_size,
                              const unsigned long long seed,
                              const unsigned long long offset)
     {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < engines_size;
+            engine_id += stride)
+        {
+            engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        }
+    }
+
+    // In all generate kernels uint4 (or the result of a distribution for it)
+    // with index i is generated by logical thread i % stride, each engine is
+    // shared by ThreadsPerEngine consecutive logical threads. If stride is
+    // greater than the number of launched threads, each block processes
+    // several blocks of logical threads.
+    //
+    // Loops over blocks are uniform because warp_reduce_min requires all threads
+    // of the engine, threads after the last logical thread (only when the block
+    // size is not a divisor of stride) are not active.
+    __forceinline__ __device__
+    unsigned int logical_threads_limit(const unsigned int stride, const size_t work_items)
+    {
+        return work_items < stride ? static_cast<unsigned int>(work_items) : stride;
     }
 
     template<unsigned int ThreadsPerEngine, class Distribution>
     __global__
     void generate_kernel(philox4x32_10_device_engine * engines,
+                         const unsigned int stride,
                          double * data, const size_t n,
                          Distribution distribution)
     {
@@ -188,66 +152,78 @@ namespace detail {
         typedef decltype(distribution(uint4())) Type2;
         typedef typename unaligned_type<Type2>::type Type2_unaligned;
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        const unsigned int limit = logical_threads_limit(stride, (n + 1) / 2);
+        for(unsigned int block_index = hipBlockIdx_x * hipBlockDim_x;
+            block_index < limit;
+            block_index += grid_size)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
-        }
+            unsigned int index = block_index + hipThreadIdx_x;
+            const unsigned int engine_id = index/ThreadsPerEngine;
+            const bool active = index < stride;
 
-        if(((uintptr_t)data)%(sizeof(Type2)) == 0)
-        {
-            Type2 * data2 = (Type2 *)data;
-            while(index < (n/2))
+            // Load device engine
+            DeviceEngineType engine;
+            if(active)
             {
-                data2[index] = distribution(engine.next4_leap(ThreadsPerEngine));
-                // Next position
-                index += stride;
+                engine = engines[engine_id];
+                if(index%ThreadsPerEngine > 0)
+                {
+                    // Skips index%ThreadsPerEngine states
+                    engine.discard(4 * (index%ThreadsPerEngine));
+                }
             }
-        }
-        else
-        {
-            Type2_unaligned * data2 = (Type2_unaligned *)data;
-            while(index < (n/2))
+
+            if(((uintptr_t)data)%(sizeof(Type2)) == 0)
             {
-                Type2 result = distribution(engine.next4_leap(ThreadsPerEngine));
-                data2[index] = *(Type2_unaligned*)(&result);  // reinterpret as Type4_unaligned
-                // Next position
-                index += stride;
+                Type2 * data2 = (Type2 *)data;
+                while(active && index < (n/2))
+                {
+                    data2[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+                    // Next position
+                    index += stride;
+                }
+            }
+            else
+            {
+                Type2_unaligned * data2 = (Type2_unaligned *)data;
+                while(active && index < (n/2))
+                {
+                    Type2 result = distribution(engine.next4_leap(ThreadsPerEngine));
+                    data2[index] = *(Type2_unaligned*)(&result);  // reinterpret as Type4_unaligned
+                    // Next position
+                    index += stride;
+                }
             }
-        }
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = (index == index_min);
-
-        // Check if we need to save tail (last 1 random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+1 (index < (n/2) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 1;
-        if((index == n/2) && tail_size > 0)
-        {
-            Type2 result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = result.x;
-        }
+            // Find thread with the smallest state of the engine which id is engine_id
+            unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+            const bool smallest_state = (index == index_min);
+
+            // Check if we need to save tail (last 1 random number).
+            // Those numbers should be generated by the thread that would
+            // save next uint4 if n was equal n+1 (index < (n/2) would be
+            // true in such situation).
+            // If this condition is met, then we know that (index == index_min)
+            // is also true for that thread, so we don't need to check that.
+            auto tail_size = n & 1;
+            if(active && (index == n/2) && tail_size > 0)
+            {
+                Type2 result = distribution(engine.next4());
+                // Save the tail
+                data[n - tail_size] = result.x;
+            }
 
-        // Save engine
-        if(smallest_state)
-            engines[engine_id] = engine;
+            // Save engine
+            if(active && smallest_state)
+                engines[engine_id] = engine;
+        }
     }
 
     template<unsigned int ThreadsPerEngine, class Type, class Distribution>
     __global__
     void generate_kernel(philox4x32_10_device_engine * engines,
+                         const unsigned int stride,
                          Type * data, const size_t n,
                          Distribution distribution)
     {
@@ -255,68 +231,80 @@ namespace detail {
         typedef decltype(distribution(uint4())) Type4;
         typedef typename unaligned_type<Type4>::type Type4_unaligned;
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        const unsigned int limit = logical_threads_limit(stride, (n + 3) / 4);
+        for(unsigned int block_index = hipBlockIdx_x * hipBlockDim_x;
+            block_index < limit;
+            block_index += grid_size)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
-        }
+            unsigned int index = block_index + hipThreadIdx_x;
+            const unsigned int engine_id = index/ThreadsPerEngine;
+            const bool active = index < stride;
 
-        if(((uintptr_t)data)%(sizeof(Type4)) == 0)
-        {
-            Type4 * data4 = (Type4 *)data;
-            while(index < (n/4))
+            // Load device engine
+            DeviceEngineType engine;
+            if(active)
             {
-                data4[index] = distribution(engine.next4_leap(ThreadsPerEngine));
-                // Next position
-                index += stride;
+                engine = engines[engine_id];
+                if(index%ThreadsPerEngine > 0)
+                {
+                    // Skips index%ThreadsPerEngine states
+                    engine.discard(4 * (index%ThreadsPerEngine));
+                }
             }
-        }
-        else
-        {
-            Type4_unaligned * data4 = (Type4_unaligned *)data;
-            while(index < (n/4))
+
+            if(((uintptr_t)data)%(sizeof(Type4)) == 0)
             {
-                Type4 result = distribution(engine.next4_leap(ThreadsPerEngine));
-                data4[index] = *(Type4_unaligned*)(&result);  // reinterpret as Type4_unaligned
-                // Next position
-                index += stride;
+                Type4 * data4 = (Type4 *)data;
+                while(active && index < (n/4))
+                {
+                    data4[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+                    // Next position
+                    index += stride;
+                }
+            }
+            else
+            {
+                Type4_unaligned * data4 = (Type4_unaligned *)data;
+                while(active && index < (n/4))
+                {
+                    Type4 result = distribution(engine.next4_leap(ThreadsPerEngine));
+                    data4[index] = *(Type4_unaligned*)(&result);  // reinterpret as Type4_unaligned
+                    // Next position
+                    index += stride;
+                }
             }
-        }
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = (index == index_min);
-
-        // Check if we need to save tail (last 1,2,3 random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+3 (index < (n/4) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 3;
-        if((index == n/4) && tail_size > 0)
-        {
-            Type4 result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = result.x;
-            if(tail_size > 1) data[n - tail_size + 1] = result.y;
-            if(tail_size > 2) data[n - tail_size + 2] = result.z;
-        }
+            // Find thread with the smallest state of the engine which id is engine_id
+            unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+            const bool smallest_state = (index == index_min);
+
+            // Check if we need to save tail (last 1,2,3 random number).
+            // Those numbers should be generated by the thread that would
+            // save next uint4 if n was equal n+3 (index < (n/4) would be
+            // true in such situation).
+            // If this condition is met, then we know that (index == index_min)
+            // is also true for that thread, so we don't need to check that.
+            auto tail_size = n & 3;
+            if(active && (index == n/4) && tail_size > 0)
+            {
+                Type4 result = distribution(engine.next4());
+                // Save the tail
+                data[n - tail_size] = result.x;
+                if(tail_size > 1) data[n - tail_size + 1] = result.y;
+                if(tail_size > 2) data[n - tail_size + 2] = result.z;
+            }
 
-        // Save engine
-        if(smallest_state)
-            engines[engine_id] = engine;
+            // Save engine
+            if(active && smallest_state)
+                engines[engine_id] = engine;
+        }
     }
 
     template<unsigned int ThreadsPerEngine, class RealType, class Distribution>
     __global__
     void generate_normal_kernel(philox4x32_10_device_engine * engines,
+                                const unsigned int stride,
                                 RealType * data, const size_t n,
                                 Distribution distribution)
     {
@@ -326,75 +314,134 @@ namespace detail {
         // x can be 2 or 4
         const unsigned x = sizeof(RealTypeX) / sizeof(RealType);
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        const unsigned int limit = logical_threads_limit(stride, (n + x - 1) / x);
+        for(unsigned int block_index = hipBlockIdx_x * hipBlockDim_x;
+            block_index < limit;
+            block_index += grid_size)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
-        }
+            unsigned int index = block_index + hipThreadIdx_x;
+            const unsigned int engine_id = index/ThreadsPerEngine;
+            const bool active = index < stride;
 
-        RealTypeX * dataX = (RealTypeX *)data;
-        while(index < (n/x))
-        {
-            dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
-            // Next position
-            index += stride;
-        }
+            // Load device engine
+            DeviceEngineType engine;
+            if(active)
+            {
+                engine = engines[engine_id];
+                if(index%ThreadsPerEngine > 0)
+                {
+                    // Skips index%ThreadsPerEngine states
+                    engine.discard(4 * (index%ThreadsPerEngine));
+                }
+            }
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = index == index_min;
-
-        // Check if we need to save tail (last 1,..,(x-1) random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+(x-1) (index < (n/x) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & (x - 1);
-        if((index == n/4) && tail_size > 0)
-        {
-            RealTypeX result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = (&result.x)[0]; // .x
-            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
-            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
-        }
+            RealTypeX * dataX = (RealTypeX *)data;
+            while(active && index < (n/x))
+            {
+                dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+                // Next position
+                index += stride;
+            }
+
+            // Find thread with the smallest state of the engine which id is engine_id
+            unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+            const bool smallest_state = index == index_min;
+
+            // Check if we need to save tail (last 1,..,(x-1) random number).
+            // Those numbers should be generated by the thread that would
+            // save next uint4 if n was equal n+(x-1) (index < (n/x) would be
+            // true in such situation).
+            // If this condition is met, then we know that (index == index_min)
+            // is also true for that thread, so we don't need to check that.
+            auto tail_size = n & (x - 1);
+            if(active && (index == n/4) && tail_size > 0)
+            {
+                RealTypeX result = distribution(engine.next4());
+                // Save the tail
+                data[n - tail_size] = (&result.x)[0]; // .x
+                if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+                if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+            }
 
-        // Save engine
-        if(smallest_state)
-            engines[engine_id] = engine;
+            // Save engine
+            if(active && smallest_state)
+                engines[engine_id] = engine;
+        }
     }
 
     template <unsigned int ThreadsPerEngine, class Distribution>
     __global__
-    void generate_poisson_kernel(philox4x32_10_device_engine * engines,
+    void generate_discrete_kernel(philox4x32_10_device_engine * engines,
+                                 const unsigned int stride,
                                  unsigned int * data, const size_t n,
                                  const Distribution distribution)
     {
         typedef philox4x32_10_device_engine DeviceEngineType;
 
-        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = index/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        const unsigned int limit = logical_threads_limit(stride, (n + 3) / 4);
+        for(unsigned int block_index = hipBlockIdx_x * hipBlockDim_x;
+            block_index < limit;
+            block_index += grid_size)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
-        }
+            unsigned int index = block_index + hipThreadIdx_x;
+            const unsigned int engine_id = index/ThreadsPerEngine;
+            const bool active = index < stride;
 
-        if(((uintptr_t)data)%(sizeof(uint4)) == 0)
-        {
-            uint4 * data4 = (uint4 *)data;
-            while(index < (n / 4))
+            // Load device engine
+            DeviceEngineType engine;
+            if(active)
+            {
+                engine = engines[engine_id];
+                if(index%ThreadsPerEngine > 0)
+                {
+                    // Skips index%ThreadsPerEngine states
+                    engine.discard(4 * (index%ThreadsPerEngine));
+                }
+            }
+
+            if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+            {
+                uint4 * data4 = (uint4 *)data;
+                while(active && index < (n / 4))
+                {
+                    const uint4 u4 = engine.next4();
+                    const uint4 result = uint4 {
+                        distribution(u4.x),
+                        distribution(u4.y),
+                        distribution(u4.z),
+                        distribution(u4.w)
+                    };
+                    data4[index] = result;
+                    index += stride;
+                }
+            }
+            else
+            {
+                uint4_unaligned * data4 = (uint4_unaligned *)data;
+                while(active && index < (n / 4))
+                {
+                    const uint4 u4 = engine.next4();
+                    const uint4 result = uint4 {
+                        distribution(u4.x),
+                        distribution(u4.y),
+                        distribution(u4.z),
+                        distribution(u4.w)
+                    };
+                    data4[index] = *(uint4_unaligned*)(&result); // reinterpret as uint4_unaligned
+                    index += stride;
+                }
+            }
+
+            // Find thread with the smallest state of the engine which id is engine_id
+            unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+            const bool smallest_state = index == index_min;
+
+            // The thread that would save next uint4 saves the tail
+            // when n is not a multiple of 4
+            auto tail_size = n & 3;
+            if(active && (index == n/4) && tail_size > 0)
             {
                 const uint4 u4 = engine.next4();
                 const uint4 result = uint4 {
@@ -403,50 +450,114 @@ namespace detail {
                     distribution(u4.z),
                     distribution(u4.w)
                 };
-                data4[index] = result;
-                index += stride;
+                data[n - tail_size] = (&result.x)[0]; // .x
+                if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+                if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
             }
+
+            // Save engine with its state
+            if(active && smallest_state)
+                engines[engine_id] = engine;
         }
-        else
+    }
+
+    // Generates pairs of standard normal values from values
+    // of the engine shared by ThreadsPerEngine threads
+    template<class RealType, unsigned int ThreadsPerEngine>
+    struct philox_normal2_generator;
+
+    template<unsigned int ThreadsPerEngine>
+    struct philox_normal2_generator<float, ThreadsPerEngine>
+    {
+        philox4x32_10_device_engine& engine;
+        uint4 values;
+        bool has_values;
+
+        __forceinline__ __device__
+        philox_normal2_generator(philox4x32_10_device_engine& engine)
+            : engine(engine), has_values(false) {}
+
+        __forceinline__ __device__
+        float2 operator()()
         {
-            uint4_unaligned * data4 = (uint4_unaligned *)data;
-            while(index < (n / 4))
+            // One uint4 is enough for two pairs
+            if(!has_values)
             {
-                const uint4 u4 = engine.next4();
-                const uint4 result = uint4 {
-                    distribution(u4.x),
-                    distribution(u4.y),
-                    distribution(u4.z),
-                    distribution(u4.w)
-                };
-                data4[index] = *(uint4_unaligned*)(&result); // reinterpret as uint4_unaligned
-                index += stride;
+                values = engine.next4_leap(ThreadsPerEngine);
+                has_values = true;
+                return ::rocrand_device::detail::box_muller(values.x, values.y);
             }
+            has_values = false;
+            return ::rocrand_device::detail::box_muller(values.z, values.w);
         }
+    };
+
+    template<unsigned int ThreadsPerEngine>
+    struct philox_normal2_generator<double, ThreadsPerEngine>
+    {
+        philox4x32_10_device_engine& engine;
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = index == index_min;
+        __forceinline__ __device__
+        philox_normal2_generator(philox4x32_10_device_engine& engine)
+            : engine(engine) {}
 
-        // First work-item saves the tail when n is not a multiple of 4
-        auto tail_size = n & 3;
-        if((index == n/4) == 0 && tail_size > 0)
+        __forceinline__ __device__
+        double2 operator()()
         {
-            const uint4 u4 = engine.next4();
-            const uint4 result = uint4 {
-                distribution(u4.x),
-                distribution(u4.y),
-                distribution(u4.z),
-                distribution(u4.w)
-            };
-            data[n - tail_size] = (&result.x)[0]; // .x
-            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
-            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+            return ::rocrand_device::detail::box_muller_double(engine.next4_leap(ThreadsPerEngine));
         }
+    };
+
+    template<unsigned int ThreadsPerEngine, unsigned int MaxDimensions, class RealType>
+    __global__
+    void generate_multivariate_normal_kernel(philox4x32_10_device_engine * engines,
+                                             const unsigned int stride,
+                                             RealType * data, const size_t n_vectors,
+                                             const multivariate_normal_distribution<RealType> distribution)
+    {
+        typedef philox4x32_10_device_engine DeviceEngineType;
+
+        __shared__ multivariate_normal_shared_data<RealType, MaxDimensions> shared;
+        distribution.load(shared);
+
+        const unsigned int grid_size = hipGridDim_x * hipBlockDim_x;
+        const unsigned int limit = logical_threads_limit(stride, n_vectors);
+        for(unsigned int block_index = hipBlockIdx_x * hipBlockDim_x;
+            block_index < limit;
+            block_index += grid_size)
+        {
+            unsigned int index = block_index + hipThreadIdx_x;
+            const unsigned int engine_id = index/ThreadsPerEngine;
+            const bool active = index < stride;
+
+            // Load device engine
+            DeviceEngineType engine;
+            if(active)
+            {
+                engine = engines[engine_id];
+                if(index%ThreadsPerEngine > 0)
+                {
+                    // Skips index%ThreadsPerEngine states
+                    engine.discard(4 * (index%ThreadsPerEngine));
+                }
+            }
+            philox_normal2_generator<RealType, ThreadsPerEngine> normal2(engine);
 
-        // Save engine with its state
-        if(smallest_state)
-            engines[engine_id] = engine;
+            while(active && index < n_vectors)
+            {
+                distribution(shared, data + static_cast<size_t>(index) * distribution.dimensions, normal2);
+                // Next position
+                index += stride;
+            }
+
+            // Find thread with the smallest state of the engine which id is engine_id
+            unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+            const bool smallest_state = (index == index_min);
+
+            // Save engine
+            if(active && smallest_state)
+                engines[engine_id] = engine;
+        }
     }
 
 } // end namespace detail
@@ -465,7 +576,12 @@ public:
                           hipStream_t stream = 0)
         : base_type(seed, offset, stream),
           m_engines_initialized(false), m_engines(NULL),
-          m_engines_size(s_threads * s_blocks / s_threads_per_engine)
+          m_config(
+              rocrand_host::detail::get_launch_config(
+                  "philox", { s_threads, s_blocks }, { 1024, 32, 65535, 1 }
+              )
+          ),
+          m_engines_size(m_config.threads * m_config.blocks / s_threads_per_engine)
     {
         // Allocate device random number engines
         auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
@@ -498,20 +614,49 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Changes ordering of results to \p order and resets generator state.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        const size_t engines_size = get_engines_size(order);
+        if(engines_size != m_engines_size)
+        {
+            engine_type * engines = NULL;
+            auto error = hipMalloc(&engines, sizeof(engine_type) * engines_size);
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            hipFree(m_engines);
+            m_engines = engines;
+            m_engines_size = engines_size;
+        }
+        m_order = order;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if(m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        rocrand_host::detail::trace_scope trace(
+            "rocrand_init", rocrand_host::detail::get_engine_name(rng_type)
+        );
+
+        const unsigned int blocks =
+            rocrand_host::detail::get_blocks(m_engines_size, m_config.threads, m_config.blocks);
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks/s_threads_per_engine), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+            dim3(blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), m_seed, m_offset
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
+        stats.record_init();
         m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -524,14 +669,22 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        // One uint4 of the engine gives 4 floats (unsigned ints) or 2 doubles
+        const size_t values_per_thread = sizeof(T) == sizeof(double) ? 2 : 4;
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, (data_size + values_per_thread - 1) / values_per_thread,
+                m_config.threads, m_config.blocks, s_portable_threads
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -559,14 +712,22 @@ public:
 
         normal_distribution<T> distribution(mean, stddev);
 
+        // One uint4 of the engine gives 4 floats (unsigned ints) or 2 doubles
+        const size_t values_per_thread = sizeof(T) == sizeof(double) ? 2 : 4;
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, (data_size + values_per_thread - 1) / values_per_thread,
+                m_config.threads, m_config.blocks, s_portable_threads
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -587,18 +748,76 @@ public:
 
         log_normal_distribution<T> distribution(mean, stddev);
 
+        // One uint4 of the engine gives 4 floats (unsigned ints) or 2 doubles
+        const size_t values_per_thread = sizeof(T) == sizeof(double) ? 2 : 4;
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, (data_size + values_per_thread - 1) / values_per_thread,
+                m_config.threads, m_config.blocks, s_portable_threads
+            );
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lower, T upper)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+        return generate(data, data_size, distribution);
+    }
+
+    template<unsigned int MaxDimensions, class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t n_vectors,
+                                                const multivariate_normal_distribution<T>& distribution)
+    {
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, n_vectors, m_config.threads, m_config.blocks, s_portable_threads
+            );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel<s_threads_per_engine, MaxDimensions>),
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, n_vectors, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_multivariate_normal(T * data, size_t n_vectors,
+                                                unsigned int dimensions,
+                                                const T * mean, const T * factor)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        multivariate_normal_distribution<T> distribution(mean, factor, dimensions);
+
+        // Use the smallest kernel which fits dimensions (less registers and shared memory)
+        if(dimensions <= 4)
+            return generate_multivariate_normal<4>(data, n_vectors, distribution);
+        else if(dimensions <= 8)
+            return generate_multivariate_normal<8>(data, n_vectors, distribution);
+        else if(dimensions <= 16)
+            return generate_multivariate_normal<16>(data, n_vectors, distribution);
+        return generate_multivariate_normal<ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS>(data, n_vectors, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         rocrand_status status = init();
@@ -607,35 +826,153 @@ public:
 
         try
         {
-            m_poisson.set_lambda(lambda);
+            if(m_poisson.set_lambda(lambda, m_stream))
+                stats.record_table_build();
         }
         catch(rocrand_status status)
         {
             return status;
         }
 
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, (data_size + 3) / 4, m_config.threads, m_config.blocks, s_portable_threads
+            );
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, m_poisson.dis
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_discrete_kernel<s_threads_per_engine>),
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, m_poisson.dis()
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double probability)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        try
+        {
+            if(m_binomial.set_parameters(trials, probability, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, (data_size + 3) / 4, m_config.threads, m_config.blocks, s_portable_threads
+            );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_discrete_kernel<s_threads_per_engine>),
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, m_binomial.dis()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_negative_binomial(unsigned int * data, size_t data_size,
+                                              double successes, double probability)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        try
+        {
+            if(m_negative_binomial.set_parameters(successes, probability, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const rocrand_host::detail::generate_launch launch =
+            rocrand_host::detail::get_generate_launch(
+                m_order, (data_size + 3) / 4, m_config.threads, m_config.blocks, s_portable_threads
+            );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_discrete_kernel<s_threads_per_engine>),
+            dim3(launch.blocks), dim3(m_config.threads), 0, m_stream,
+            m_engines, launch.stride, data, data_size, m_negative_binomial.dis()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status prepare_poisson(double lambda)
+    {
+        return prepare_table(m_poisson, lambda);
+    }
+
+    rocrand_status prepare_binomial(unsigned int trials, double probability)
+    {
+        return prepare_table(m_binomial, trials, probability);
+    }
+
+    rocrand_status prepare_negative_binomial(double successes, double probability)
+    {
+        return prepare_table(m_negative_binomial, successes, probability);
+    }
+
+    rocrand_status release_prepared_tables()
+    {
+        // Freeing memory used by a graph being captured invalidates the capture
+        if(rocrand_host::detail::is_capturing(m_stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        m_poisson.release_prepared();
+        m_binomial.release_prepared();
+        m_negative_binomial.release_prepared();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
 private:
+    // Number of engines required for ordering order
+    size_t get_engines_size(rocrand_ordering order) const
+    {
+        const size_t engines_size = m_config.threads * m_config.blocks / s_threads_per_engine;
+        if(order == ROCRAND_ORDERING_PSEUDO_PORTABLE)
+            return std::max<size_t>(engines_size, s_portable_threads / s_threads_per_engine);
+        return engines_size;
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
-    const size_t m_engines_size;
+    // Launch parameters (from the tuning file or default)
+    const rocrand_host::detail::launch_config m_config;
+    size_t m_engines_size;
 
+    // Default launch parameters
     const static uint32_t s_threads = 256;
     const static uint32_t s_blocks = 1024;
+    // Number of logical threads (stride) with ROCRAND_ORDERING_PSEUDO_PORTABLE,
+    // it is equal to the number of threads with the default launch parameters
+    const static uint32_t s_portable_threads = 256 * 1024;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    // For caching of binomial and negative binomial tables
+    binomial_distribution_manager<> m_binomial;
+    negative_binomial_distribution_manager<> m_negative_binomial;
 
     // m_seed from base_type
     // m_offset from base_type
@@ -0,0 +1,79 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOA_ENGINES_H_
+#define ROCRAND_RNG_SOA_ENGINES_H_
+
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Device engines stored as a structure of arrays: 32-bit word w of engine i
+    // is words[w * size + i], so consecutive threads load and save consecutive
+    // words of their engines (coalesced accesses instead of strided loads of
+    // whole engines).
+    template<class Engine>
+    struct soa_engines
+    {
+        static_assert(sizeof(Engine) % sizeof(unsigned int) == 0,
+                      "Engine must consist of 32-bit words");
+        static const unsigned int words_per_engine = sizeof(Engine) / sizeof(unsigned int);
+
+        unsigned int * words;
+        unsigned int size;
+
+        hipError_t allocate(size_t engines_size)
+        {
+            size = static_cast<unsigned int>(engines_size);
+            return hipMalloc(&words, sizeof(Engine) * engines_size);
+        }
+
+        void deallocate()
+        {
+            hipFree(words);
+        }
+
+        __forceinline__ __device__
+        Engine load(const unsigned int engine_id) const
+        {
+            unsigned int state[words_per_engine];
+            for(unsigned int w = 0; w < words_per_engine; w++)
+            {
+                state[w] = words[w * size + engine_id];
+            }
+            return *reinterpret_cast<const Engine *>(state);
+        }
+
+        __forceinline__ __device__
+        void save(const unsigned int engine_id, const Engine& engine) const
+        {
+            const unsigned int * state = reinterpret_cast<const unsigned int *>(&engine);
+            for(unsigned int w = 0; w < words_per_engine; w++)
+            {
+                words[w * size + engine_id] = state[w];
+            }
+        }
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SOA_ENGINES_H_
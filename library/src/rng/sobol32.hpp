@@ -22,12 +22,14 @@
 #define ROCRAND_RNG_SOBOL32_H_
 
 #include <algorithm>
+#include <cmath>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
 #include <rocrand_sobol_precomputed.h>
 
 #include "generator_type.hpp"
+#include "launch_config.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
 
@@ -68,6 +70,74 @@ namespace detail {
         }
     }
 
+    template<class RealType>
+    __forceinline__ __device__
+    RealType brownian_bridge_normal(const unsigned int x);
+
+    template<>
+    __forceinline__ __device__
+    float brownian_bridge_normal<float>(const unsigned int x)
+    {
+        return ::rocrand_device::detail::normal_distribution(x);
+    }
+
+    template<>
+    __forceinline__ __device__
+    double brownian_bridge_normal<double>(const unsigned int x)
+    {
+        return ::rocrand_device::detail::normal_distribution_double(x);
+    }
+
+    template<class RealType>
+    __global__
+    void generate_brownian_bridge_kernel(RealType * data, const size_t n,
+                                         const unsigned int * direction_vectors,
+                                         const unsigned int offset,
+                                         const unsigned int * row_offsets,
+                                         const unsigned int * columns,
+                                         const double * coefficients,
+                                         const double scale)
+    {
+        const unsigned int step = hipBlockIdx_y;
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // W[step] is a linear combination of normal values of the dimensions
+        // (columns) from the row of the bridge matrix. Each thread of the current
+        // block uses the same direction vectors and weights of these dimensions.
+        __shared__ unsigned int vectors[ROCRAND_BROWNIAN_BRIDGE_MAX_TERMS][32];
+        __shared__ RealType weights[ROCRAND_BROWNIAN_BRIDGE_MAX_TERMS];
+        const unsigned int row_begin = row_offsets[step];
+        const unsigned int terms = row_offsets[step + 1] - row_begin;
+        for(unsigned int i = hipThreadIdx_x; i < terms * 32; i += hipBlockDim_x)
+        {
+            const unsigned int k = i / 32;
+            const unsigned int b = i % 32;
+            vectors[k][b] = direction_vectors[columns[row_begin + k] * 32 + b];
+        }
+        if(hipThreadIdx_x < terms)
+        {
+            weights[hipThreadIdx_x] =
+                static_cast<RealType>(scale * coefficients[row_begin + hipThreadIdx_x]);
+        }
+        __syncthreads();
+
+        const unsigned int start = step * n;
+        unsigned int index = engine_id;
+        while(index < n)
+        {
+            RealType w = 0;
+            for(unsigned int k = 0; k < terms; k++)
+            {
+                // The same point of the sequence is used for all dimensions
+                sobol32_device_engine engine(vectors[k], offset + index);
+                w += weights[k] * brownian_bridge_normal<RealType>(engine.current());
+            }
+            data[start + index] = w;
+            index += stride;
+        }
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -81,7 +151,12 @@ public:
                     hipStream_t stream = 0)
         : base_type(0, offset, stream),
           m_initialized(false),
-          m_dimensions(1)
+          m_dimensions(1),
+          m_config(
+              rocrand_host::detail::get_launch_config(
+                  "sobol32", { s_threads, s_max_blocks }, { 1024, 32, 65535, 1 }
+              )
+          )
     {
         // Allocate direction vectors
         hipError_t error;
@@ -113,6 +188,19 @@ public:
         m_initialized = false;
     }
 
+    /// Changes ordering of results to \p order, results of Sobol32
+    /// never depend on launch parameters.
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        m_order = order;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    unsigned int get_dimensions() const
+    {
+        return m_dimensions;
+    }
+
     void set_dimensions(unsigned int dimensions)
     {
         m_dimensions = dimensions;
@@ -124,7 +212,12 @@ public:
         if (m_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        rocrand_host::detail::trace_scope trace(
+            "rocrand_init", rocrand_host::detail::get_engine_name(rng_type)
+        );
+
         m_current_offset = static_cast<unsigned int>(m_offset);
+        stats.record_init();
         m_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -141,13 +234,8 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        #ifdef __HIP_PLATFORM_NVCC__
-        const uint32_t threads = 64;
-        const uint32_t max_blocks = 4096;
-        #else
-        const uint32_t threads = 256;
-        const uint32_t max_blocks = 4096;
-        #endif
+        const uint32_t threads = m_config.threads;
+        const uint32_t max_blocks = m_config.blocks;
 
         const size_t size = data_size / m_dimensions;
         const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
@@ -166,6 +254,7 @@ public:
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
 
         m_current_offset += size;
 
@@ -193,17 +282,138 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lower, T upper)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lower, upper);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_brownian_bridge(T * data, size_t data_size, T time_step)
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        try
+        {
+            if(m_brownian_bridge.set_dimensions(m_dimensions, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const uint32_t threads = m_config.threads;
+        const uint32_t max_blocks = m_config.blocks;
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+
+        // One row of blocks per time step, number of paths is the number of points
+        const uint32_t blocks_x = (blocks + m_dimensions - 1) / m_dimensions;
+        const uint32_t blocks_y = m_dimensions;
+        const rocrand_brownian_bridge& bridge = m_brownian_bridge.bridge();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_brownian_bridge_kernel),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size,
+            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
+            static_cast<const unsigned int*>(bridge.row_offsets),
+            static_cast<const unsigned int*>(bridge.columns),
+            static_cast<const double*>(bridge.coefficients),
+            std::sqrt(static_cast<double>(time_step))
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        stats.record_launch();
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            if(m_poisson.set_lambda(lambda, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis());
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double probability)
+    {
+        try
+        {
+            if(m_binomial.set_parameters(trials, probability, m_stream))
+                stats.record_table_build();
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_binomial.dis());
+    }
+
+    rocrand_status generate_negative_binomial(unsigned int * data, size_t data_size,
+                                              double successes, double probability)
+    {
+        try
+        {
+            if(m_negative_binomial.set_parameters(successes, probability, m_stream))
+                stats.record_table_build();
         }
         catch(rocrand_status status)
         {
             return status;
         }
-        return generate(data, data_size, m_poisson.dis);
+        return generate(data, data_size, m_negative_binomial.dis());
+    }
+
+    rocrand_status prepare_poisson(double lambda)
+    {
+        return prepare_table(m_poisson, lambda);
+    }
+
+    rocrand_status prepare_binomial(unsigned int trials, double probability)
+    {
+        return prepare_table(m_binomial, trials, probability);
+    }
+
+    rocrand_status prepare_negative_binomial(double successes, double probability)
+    {
+        return prepare_table(m_negative_binomial, successes, probability);
+    }
+
+    rocrand_status prepare_brownian_bridge()
+    {
+        return prepare_table(m_brownian_bridge, m_dimensions);
+    }
+
+    rocrand_status release_prepared_tables()
+    {
+        // Freeing memory used by a graph being captured invalidates the capture
+        if(rocrand_host::detail::is_capturing(m_stream))
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        m_poisson.release_prepared();
+        m_binomial.release_prepared();
+        m_negative_binomial.release_prepared();
+        m_brownian_bridge.release_prepared();
+        return ROCRAND_STATUS_SUCCESS;
     }
 
 private:
@@ -211,9 +421,25 @@ private:
     unsigned int m_dimensions;
     unsigned int m_current_offset;
     unsigned int * m_direction_vectors;
+    // Launch parameters (from the tuning file or default),
+    // blocks is the maximum number of blocks
+    const rocrand_host::detail::launch_config m_config;
+    // Default launch parameters
+    #ifdef __HIP_PLATFORM_NVCC__
+    static const uint32_t s_threads = 64;
+    static const uint32_t s_max_blocks = 4096;
+    #else
+    static const uint32_t s_threads = 256;
+    static const uint32_t s_max_blocks = 4096;
+    #endif
 
     // For caching of Poisson for consecutive generations with the same lambda
-    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_GUIDE_TABLE> m_poisson;
+    // For caching of binomial and negative binomial tables
+    binomial_distribution_manager<ROCRAND_DISCRETE_METHOD_GUIDE_TABLE> m_binomial;
+    negative_binomial_distribution_manager<ROCRAND_DISCRETE_METHOD_GUIDE_TABLE> m_negative_binomial;
+    // For caching of the Brownian bridge matrix for the current number of dimensions
+    brownian_bridge_manager m_brownian_bridge;
 
     // m_offset from base_type
 
@@ -0,0 +1,249 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TRACE_H_
+#define ROCRAND_RNG_TRACE_H_
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#ifdef ROCRAND_USE_ROCTX
+#include <roctx.h>
+#endif
+
+// Name of the environment variable which enables tracing of API calls,
+// initialization of generators and computation of distribution tables.
+//
+// Values:
+// - "roctx" - named roctx ranges (shown by rocprof --roctx-trace), available
+//   only if the library is built with roctx (ENABLE_ROCTX);
+// - a path - events are written to the file in Chrome trace-event JSON format
+//   (chrome://tracing, Perfetto), timestamps are microseconds of the monotonic
+//   clock, so events can be aligned with rocprof traces.
+//
+// Events are tagged with the generator's engine, the distribution and
+// the number of values. The variable is read once, when the first event occurs.
+// The file is complete when the process exits normally.
+#define ROCRAND_TRACE_ENV "ROCRAND_TRACE"
+
+namespace rocrand_host {
+namespace detail {
+
+// Returns name of the engine of rng_type as in tuning files, NULL if rng_type
+// is not a valid type of generators
+inline const char * get_engine_name(rocrand_rng_type rng_type)
+{
+    switch(rng_type)
+    {
+        case ROCRAND_RNG_PSEUDO_PHILOX4_32_10: return "philox";
+        case ROCRAND_RNG_PSEUDO_MRG32K3A: return "mrg32k3a";
+        case ROCRAND_RNG_PSEUDO_DEFAULT:
+        case ROCRAND_RNG_PSEUDO_XORWOW: return "xorwow";
+        case ROCRAND_RNG_PSEUDO_MTGP32: return "mtgp32";
+        case ROCRAND_RNG_QUASI_DEFAULT:
+        case ROCRAND_RNG_QUASI_SOBOL32: return "sobol32";
+    }
+    return NULL;
+}
+
+class tracer
+{
+public:
+    enum mode_type
+    {
+        disabled,
+        roctx,
+        json
+    };
+
+    // The tracer is never destroyed, so generators destroyed by destructors
+    // of static objects can be traced. The JSON array is not closed,
+    // viewers accept such files.
+    static tracer& instance()
+    {
+        static tracer * t = new tracer();
+        return *t;
+    }
+
+    mode_type mode() const
+    {
+        return m_mode;
+    }
+
+    void write_event(const std::string& name,
+                     const std::string& args,
+                     double start_us,
+                     double end_us)
+    {
+        std::ostringstream event;
+        event.precision(3);
+        event << std::fixed
+            << "{\"name\":\"" << name << "\",\"cat\":\"rocrand\",\"ph\":\"X\""
+            << ",\"ts\":" << start_us << ",\"dur\":" << (end_us - start_us)
+            << ",\"pid\":" << ::getpid()
+            << ",\"tid\":" << static_cast<unsigned int>(
+                    std::hash<std::thread::id>()(std::this_thread::get_id())
+                )
+            << ",\"args\":{" << args << "}}";
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_file << (m_first ? "" : ",\n") << event.str();
+        m_first = false;
+        // Events of destructors of static objects which run after at_exit
+        if(m_exited)
+            m_file.flush();
+    }
+
+private:
+    tracer()
+        : m_mode(disabled), m_first(true), m_exited(false)
+    {
+        const char * value = std::getenv(ROCRAND_TRACE_ENV);
+        if(value == NULL || value[0] == '\0')
+            return;
+
+        if(std::strcmp(value, "roctx") == 0)
+        {
+#ifdef ROCRAND_USE_ROCTX
+            m_mode = roctx;
+#else
+            std::fprintf(
+                stderr,
+                "rocRAND: " ROCRAND_TRACE_ENV "=roctx is ignored, "
+                "the library is built without roctx (ENABLE_ROCTX)\n"
+            );
+#endif
+            return;
+        }
+
+        m_file.open(value, std::ios::out | std::ios::trunc);
+        if(m_file)
+        {
+            m_file << "[\n";
+            m_mode = json;
+            // Events are buffered by the stream and written at exit
+            std::atexit(&tracer::at_exit);
+        }
+    }
+
+    static void at_exit()
+    {
+        tracer& t = instance();
+        std::lock_guard<std::mutex> lock(t.m_mutex);
+        t.m_file.flush();
+        t.m_exited = true;
+    }
+
+    mode_type m_mode;
+    std::ofstream m_file;
+    std::mutex m_mutex;
+    bool m_first;
+    bool m_exited;
+};
+
+// Traces the lifetime of the scope as a range or a complete event named name.
+// engine and distribution can be NULL, size is omitted if it is zero.
+class trace_scope
+{
+public:
+    trace_scope(const char * name,
+                const char * engine = NULL,
+                const char * distribution = NULL,
+                size_t size = 0)
+        : m_mode(tracer::instance().mode())
+    {
+        if(m_mode == tracer::disabled)
+            return;
+
+        std::ostringstream args;
+        const char * separator = "";
+        if(engine != NULL)
+        {
+            args << "\"engine\":\"" << engine << "\"";
+            separator = ",";
+        }
+        if(distribution != NULL)
+        {
+            args << separator << "\"distribution\":\"" << distribution << "\"";
+            separator = ",";
+        }
+        if(size != 0)
+        {
+            args << separator << "\"size\":" << size;
+        }
+
+        m_name = name;
+        m_args = args.str();
+#ifdef ROCRAND_USE_ROCTX
+        if(m_mode == tracer::roctx)
+        {
+            roctxRangePushA((m_name + " {" + m_args + "}").c_str());
+            return;
+        }
+#endif
+        m_start = now_us();
+    }
+
+    ~trace_scope()
+    {
+#ifdef ROCRAND_USE_ROCTX
+        if(m_mode == tracer::roctx)
+        {
+            roctxRangePop();
+            return;
+        }
+#endif
+        if(m_mode == tracer::json)
+        {
+            tracer::instance().write_event(m_name, m_args, m_start, now_us());
+        }
+    }
+
+private:
+    static double now_us()
+    {
+        return std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+
+    tracer::mode_type m_mode;
+    std::string m_name;
+    std::string m_args;
+    double m_start;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TRACE_H_
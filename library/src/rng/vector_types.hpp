@@ -0,0 +1,118 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_VECTOR_TYPES_H_
+#define ROCRAND_RNG_VECTOR_TYPES_H_
+
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    struct double2_unaligned
+    {
+        double x;
+        double y;
+    };
+
+    struct uint4_unaligned
+    {
+        unsigned int x;
+        unsigned int y;
+        unsigned int z;
+        unsigned int w;
+    };
+
+    struct float4_unaligned
+    {
+        float x;
+        float y;
+        float z;
+        float w;
+    };
+
+    struct double4_unaligned
+    {
+        double x;
+        double y;
+        double z;
+        double w;
+    };
+
+    template<class T>
+    struct unaligned_type
+    {
+        typedef void type;
+    };
+
+    template<>
+    struct unaligned_type<double2>
+    {
+        typedef double2_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<uint4>
+    {
+        typedef uint4_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<float4>
+    {
+        typedef float4_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<double4>
+    {
+        typedef double4_unaligned type;
+    };
+
+    // Vector of 4 values of type T, it is used by generate kernels
+    // which produce 4 values per iteration and save them with vector stores
+    template<class T>
+    struct vector4_type
+    {
+        typedef void type;
+    };
+
+    template<>
+    struct vector4_type<unsigned int>
+    {
+        typedef uint4 type;
+    };
+
+    template<>
+    struct vector4_type<float>
+    {
+        typedef float4 type;
+    };
+
+    template<>
+    struct vector4_type<double>
+    {
+        typedef double4 type;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_VECTOR_TYPES_H_
@@ -21,6 +21,8 @@
 #include <hip/hip_runtime.h>
 
 #include "rng/generators.hpp"
+#include "rng/host_prefetcher.hpp"
+#include "rng/trace.hpp"
 
 #include <rocrand.h>
 #include <new>
@@ -32,6 +34,14 @@ extern "C" {
 rocrand_status ROCRANDAPI
 rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type)
 {
+    const char * engine = rocrand_host::detail::get_engine_name(rng_type);
+    if(engine == NULL)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_host::detail::trace_scope trace(__func__, engine);
+
     try
     {
         if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
@@ -75,6 +85,11 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
 rocrand_status ROCRANDAPI
 rocrand_destroy_generator(rocrand_generator generator)
 {
+    rocrand_host::detail::trace_scope trace(
+        __func__,
+        generator != NULL ? rocrand_host::detail::get_engine_name(generator->rng_type) : NULL
+    );
+
     try
     {
         delete(generator);
@@ -95,394 +110,1088 @@ rocrand_generate(rocrand_generator generator,
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "uniform",
+        &rocrand_generator_stats::uniform_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate(output_data, n));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform(rocrand_generator generator,
+                         float * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "uniform",
+        &rocrand_generator_stats::uniform_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_uniform(output_data, n));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double(rocrand_generator generator,
+                                double * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "uniform",
+        &rocrand_generator_stats::uniform_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        return scope.done(philox4x32_10_generator->generate_uniform(output_data, n));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_uniform(output_data, n));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_uniform(output_data, n));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "normal",
+        &rocrand_generator_stats::normal_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_normal(output_data, n,
+                                                                   mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_normal(output_data, n,
+                                                              mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_normal(output_data, n,
+                                                                    mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_normal(output_data, n,
+                                                                     mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "normal",
+        &rocrand_generator_stats::normal_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_normal(output_data, n,
+                                                                   mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_normal(output_data, n,
+                                                              mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_normal(output_data, n,
+                                                                    mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_normal(output_data, n,
+                                                                     mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal(rocrand_generator generator,
+                            float * output_data, size_t n,
+                            float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "log_normal",
+        &rocrand_generator_stats::log_normal_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_log_normal(output_data, n,
+                                                                       mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_log_normal(output_data, n,
+                                                                  mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_log_normal(output_data, n,
+                                                                         mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double(rocrand_generator generator,
+                                   double * output_data, size_t n,
+                                   double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "log_normal",
+        &rocrand_generator_stats::log_normal_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_log_normal(output_data, n,
+                                                                       mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_log_normal(output_data, n,
+                                                                  mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_log_normal(output_data, n,
+                                                                         mean, stddev));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lower, float upper)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(!(stddev > 0) || !(lower < upper))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "truncated_normal",
+        &rocrand_generator_stats::truncated_normal_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_truncated_normal(output_data, n,
+                                                                             mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_truncated_normal(output_data, n,
+                                                                        mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_truncated_normal(output_data, n,
+                                                                              mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_truncated_normal(output_data, n,
+                                                                               mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_truncated_normal(output_data, n,
+                                                                              mean, stddev, lower, upper));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lower, double upper)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(!(stddev > 0) || !(lower < upper))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "truncated_normal",
+        &rocrand_generator_stats::truncated_normal_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_truncated_normal(output_data, n,
+                                                                             mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_truncated_normal(output_data, n,
+                                                                        mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_truncated_normal(output_data, n,
+                                                                              mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_truncated_normal(output_data, n,
+                                                                               mean, stddev, lower, upper));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_truncated_normal(output_data, n,
+                                                                              mean, stddev, lower, upper));
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data, size_t n_vectors,
+                                     unsigned int dimensions,
+                                     const float * mean,
+                                     const float * cholesky_factor)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(dimensions == 0 || dimensions > ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS ||
+       mean == NULL || cholesky_factor == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "multivariate_normal",
+        &rocrand_generator_stats::multivariate_normal_numbers, output_data, n_vectors * dimensions
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                                dimensions, mean, cholesky_factor));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                           dimensions, mean, cholesky_factor));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                                 dimensions, mean, cholesky_factor));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                                 dimensions, mean, cholesky_factor));
+    }
+    // Quasi-random generators are not supported: values of one vector
+    // must be independent
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal_double(rocrand_generator generator,
+                                            double * output_data, size_t n_vectors,
+                                            unsigned int dimensions,
+                                            const double * mean,
+                                            const double * cholesky_factor)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(dimensions == 0 || dimensions > ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS ||
+       mean == NULL || cholesky_factor == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "multivariate_normal",
+        &rocrand_generator_stats::multivariate_normal_numbers, output_data, n_vectors * dimensions
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return scope.done(philox4x32_10_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                                dimensions, mean, cholesky_factor));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return scope.done(mrg32k3a_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                           dimensions, mean, cholesky_factor));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return scope.done(rocrand_xorwow_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                                 dimensions, mean, cholesky_factor));
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return scope.done(rocrand_mtgp32_generator->generate_multivariate_normal(output_data, n_vectors,
+                                                                                 dimensions, mean, cholesky_factor));
+    }
+    // Quasi-random generators are not supported: values of one vector
+    // must be independent
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_bridge(rocrand_generator generator,
+                                 float * output_data, size_t n,
+                                 float time_step)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(!(time_step > 0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "brownian_bridge",
+        &rocrand_generator_stats::brownian_bridge_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return scope.done(rocrand_sobol32_generator->generate_brownian_bridge(output_data, n,
+                                                                              time_step));
+    }
+    // Paths are built from dimensions of a quasi-random sequence
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_bridge_double(rocrand_generator generator,
+                                        double * output_data, size_t n,
+                                        double time_step)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(!(time_step > 0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "brownian_bridge",
+        &rocrand_generator_stats::brownian_bridge_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        return scope.status();
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
-    {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        return scope.done(rocrand_sobol32_generator->generate_brownian_bridge(output_data, n,
+                                                                              time_step));
     }
+    // Paths are built from dimensions of a quasi-random sequence
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform(rocrand_generator generator,
-                         float * output_data, size_t n)
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "poisson",
+        &rocrand_generator_stats::poisson_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return scope.done(philox4x32_10_generator->generate_poisson(output_data, n,
+                                                                    lambda));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
         rocrand_mrg32k3a * mrg32k3a_generator =
             static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return scope.done(mrg32k3a_generator->generate_poisson(output_data, n,
+                                                               lambda));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
         rocrand_xorwow * rocrand_xorwow_generator =
             static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return scope.done(rocrand_xorwow_generator->generate_poisson(output_data, n,
+                                                                     lambda));
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return scope.done(rocrand_sobol32_generator->generate_poisson(output_data, n,
+                                                                      lambda));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
         rocrand_mtgp32 * rocrand_mtgp32_generator =
             static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        return scope.done(rocrand_mtgp32_generator->generate_poisson(output_data, n,
+                                                                     lambda));
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform_double(rocrand_generator generator,
-                                double * output_data, size_t n)
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int trials, double probability)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if (probability < 0.0 || probability > 1.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "binomial",
+        &rocrand_generator_stats::binomial_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return scope.done(philox4x32_10_generator->generate_binomial(output_data, n,
+                                                                      trials, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
         rocrand_mrg32k3a * mrg32k3a_generator =
             static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return scope.done(mrg32k3a_generator->generate_binomial(output_data, n,
+                                                                 trials, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
         rocrand_xorwow * rocrand_xorwow_generator =
             static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return scope.done(rocrand_xorwow_generator->generate_binomial(output_data, n,
+                                                                       trials, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return scope.done(rocrand_sobol32_generator->generate_binomial(output_data, n,
+                                                                        trials, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
         rocrand_mtgp32 * rocrand_mtgp32_generator =
             static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        return scope.done(rocrand_mtgp32_generator->generate_binomial(output_data, n,
+                                                                       trials, probability));
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_normal(rocrand_generator generator,
-                        float * output_data, size_t n,
-                        float mean, float stddev)
+rocrand_generate_negative_binomial(rocrand_generator generator,
+                                   unsigned int * output_data, size_t n,
+                                   double successes, double probability)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if (successes <= 0.0 || probability <= 0.0 || probability > 1.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::generate_scope scope(
+        __func__, generator, "negative_binomial",
+        &rocrand_generator_stats::negative_binomial_numbers, output_data, n
+    );
+    if(scope.status() != ROCRAND_STATUS_SUCCESS)
+    {
+        return scope.status();
+    }
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        return scope.done(philox4x32_10_generator->generate_negative_binomial(output_data, n,
+                                                                               successes, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
         rocrand_mrg32k3a * mrg32k3a_generator =
             static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        return scope.done(mrg32k3a_generator->generate_negative_binomial(output_data, n,
+                                                                          successes, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
         rocrand_xorwow * rocrand_xorwow_generator =
             static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        return scope.done(rocrand_xorwow_generator->generate_negative_binomial(output_data, n,
+                                                                                successes, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        return scope.done(rocrand_sobol32_generator->generate_negative_binomial(output_data, n,
+                                                                                 successes, probability));
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
         rocrand_mtgp32 * rocrand_mtgp32_generator =
             static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        return scope.done(rocrand_mtgp32_generator->generate_negative_binomial(output_data, n,
+                                                                                successes, probability));
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_normal_double(rocrand_generator generator,
-                               double * output_data, size_t n,
-                               double mean, double stddev)
+rocrand_initialize_generator(rocrand_generator generator)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        return static_cast<rocrand_xorwow *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        return static_cast<rocrand_sobol32 *>(generator)->init();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        return static_cast<rocrand_mtgp32 *>(generator)->init();
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal(rocrand_generator generator,
-                            float * output_data, size_t n,
-                            float mean, float stddev)
+rocrand_prepare_poisson(rocrand_generator generator, double lambda)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type), "poisson"
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->prepare_poisson(lambda);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->prepare_poisson(lambda);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_xorwow *>(generator)->prepare_poisson(lambda);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return static_cast<rocrand_sobol32 *>(generator)->prepare_poisson(lambda);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_mtgp32 *>(generator)->prepare_poisson(lambda);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_double(rocrand_generator generator,
-                                   double * output_data, size_t n,
-                                   double mean, double stddev)
+rocrand_prepare_binomial(rocrand_generator generator,
+                         unsigned int trials, double probability)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if (probability < 0.0 || probability > 1.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type), "binomial"
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->prepare_binomial(trials, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->prepare_binomial(trials, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_xorwow *>(generator)->prepare_binomial(trials, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return static_cast<rocrand_sobol32 *>(generator)->prepare_binomial(trials, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_mtgp32 *>(generator)->prepare_binomial(trials, probability);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda)
+rocrand_prepare_negative_binomial(rocrand_generator generator,
+                                  double successes, double probability)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (lambda <= 0.0)
+
+    if (successes <= 0.0 || probability <= 0.0 || probability > 1.0)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type), "negative_binomial"
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_poisson(output_data, n,
-                                                         lambda);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->prepare_negative_binomial(successes, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_poisson(output_data, n,
-                                                    lambda);
+        return static_cast<rocrand_mrg32k3a *>(generator)->prepare_negative_binomial(successes, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        return static_cast<rocrand_xorwow *>(generator)->prepare_negative_binomial(successes, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_poisson(output_data, n,
-                                                           lambda);
+        return static_cast<rocrand_sobol32 *>(generator)->prepare_negative_binomial(successes, probability);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        return static_cast<rocrand_mtgp32 *>(generator)->prepare_negative_binomial(successes, probability);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator)
+rocrand_prepare_brownian_bridge(rocrand_generator generator)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type), "brownian_bridge"
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->prepare_brownian_bridge();
+    }
+    // Paths are built from dimensions of a quasi-random sequence
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_release_prepared_tables(rocrand_generator generator)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+        return static_cast<rocrand_philox4x32_10 *>(generator)->release_prepared_tables();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        return static_cast<rocrand_mrg32k3a *>(generator)->init();
+        return static_cast<rocrand_mrg32k3a *>(generator)->release_prepared_tables();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        return static_cast<rocrand_xorwow *>(generator)->init();
+        return static_cast<rocrand_xorwow *>(generator)->release_prepared_tables();
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        return static_cast<rocrand_sobol32 *>(generator)->init();
+        return static_cast<rocrand_sobol32 *>(generator)->release_prepared_tables();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        return static_cast<rocrand_mtgp32 *>(generator)->init();
+        return static_cast<rocrand_mtgp32 *>(generator)->release_prepared_tables();
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
@@ -495,6 +1204,10 @@ rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
@@ -531,6 +1244,10 @@ rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
@@ -566,6 +1283,10 @@ rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
@@ -594,6 +1315,76 @@ rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+        ? order != ROCRAND_ORDERING_QUASI_DEFAULT
+        : order != ROCRAND_ORDERING_PSEUDO_DEFAULT && order != ROCRAND_ORDERING_PSEUDO_PORTABLE)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_order(order);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_order(order);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_generator_stats(rocrand_generator generator,
+                            rocrand_generator_stats_mode mode)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    return generator->stats.set_mode(mode);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_generator_stats(rocrand_generator generator,
+                            rocrand_generator_stats * stats)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stats == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->stats.get(stats);
+}
+
 rocrand_status ROCRANDAPI
 rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
                                               unsigned int dimensions)
@@ -602,11 +1393,16 @@ rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+
     if(dimensions < 1 || dimensions > 20000)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
     if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
@@ -640,6 +1436,8 @@ rocrand_create_poisson_distribution(double lambda,
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
+    rocrand_host::detail::trace_scope trace(__func__, NULL, "poisson");
+
     rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
     try
     {
@@ -684,6 +1482,8 @@ rocrand_create_discrete_distribution(const double * probabilities,
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
+    rocrand_host::detail::trace_scope trace(__func__, NULL, "discrete", size);
+
     rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
     try
     {
@@ -721,6 +1521,8 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
+    rocrand_host::detail::trace_scope trace(__func__);
+
     rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
 
     hipError_t error;
@@ -748,6 +1550,96 @@ rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_dis
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_create_host_prefetcher(rocrand_host_prefetcher * prefetcher,
+                               rocrand_generator generator,
+                               rocrand_prefetch_type type,
+                               size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(type != ROCRAND_PREFETCH_UINT
+        && type != ROCRAND_PREFETCH_UNIFORM_FLOAT
+        && type != ROCRAND_PREFETCH_UNIFORM_DOUBLE
+        && type != ROCRAND_PREFETCH_NORMAL_FLOAT
+        && type != ROCRAND_PREFETCH_NORMAL_DOUBLE)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    if(n == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    // The same checks as in generate functions, so an invalid size is
+    // reported here and not by the first rocrand_host_prefetcher_next()
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        if(n % rocrand_sobol32_generator->get_dimensions() != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+    }
+    else if((type == ROCRAND_PREFETCH_NORMAL_FLOAT || type == ROCRAND_PREFETCH_NORMAL_DOUBLE)
+        && (generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A
+            || generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        && n % 2 != 0)
+    {
+        // Normal values are generated in pairs (Box-Muller transform)
+        return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+    }
+
+    rocrand_host::detail::trace_scope trace(
+        __func__, rocrand_host::detail::get_engine_name(generator->rng_type)
+    );
+
+    try
+    {
+        *prefetcher = new rocrand_host_prefetcher_type(generator, type, n);
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_host_prefetcher_next(rocrand_host_prefetcher prefetcher,
+                             const void ** output)
+{
+    if(prefetcher == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::trace_scope trace(__func__);
+    return prefetcher->next(output);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_destroy_host_prefetcher(rocrand_host_prefetcher prefetcher)
+{
+    if(prefetcher == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    rocrand_host::detail::trace_scope trace(__func__);
+
+    delete prefetcher;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -61,6 +61,34 @@ ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404
 ROCRAND_RNG_QUASI_DEFAULT = 500
 ROCRAND_RNG_QUASI_SOBOL32 = 501
 
+ROCRAND_PREFETCH_UINT = 0
+ROCRAND_PREFETCH_UNIFORM_FLOAT = 1
+ROCRAND_PREFETCH_UNIFORM_DOUBLE = 2
+ROCRAND_PREFETCH_NORMAL_FLOAT = 3
+ROCRAND_PREFETCH_NORMAL_DOUBLE = 4
+
+ROCRAND_GENERATOR_STATS_DISABLED = 0
+ROCRAND_GENERATOR_STATS_COUNTERS = 1
+ROCRAND_GENERATOR_STATS_TIMING = 2
+
+class rocrand_generator_stats(Structure):
+    _fields_ = [
+        ("uniform_numbers", c_ulonglong),
+        ("normal_numbers", c_ulonglong),
+        ("log_normal_numbers", c_ulonglong),
+        ("truncated_normal_numbers", c_ulonglong),
+        ("multivariate_normal_numbers", c_ulonglong),
+        ("brownian_bridge_numbers", c_ulonglong),
+        ("poisson_numbers", c_ulonglong),
+        ("binomial_numbers", c_ulonglong),
+        ("negative_binomial_numbers", c_ulonglong),
+        ("generate_calls", c_ulonglong),
+        ("kernel_launches", c_ulonglong),
+        ("initializations", c_ulonglong),
+        ("table_builds", c_ulonglong),
+        ("kernel_time_ms", c_double)
+    ]
+
 ROCRAND_STATUS_SUCCESS = 0
 ROCRAND_STATUS_VERSION_MISMATCH = 100
 ROCRAND_STATUS_NOT_CREATED = 101
@@ -127,6 +155,13 @@ class RocRandError(Exception):
 class RNG(object):
     """Random number generator base class."""
 
+    STATS_DISABLED = ROCRAND_GENERATOR_STATS_DISABLED
+    """Statistics are not collected (default)"""
+    STATS_COUNTERS = ROCRAND_GENERATOR_STATS_COUNTERS
+    """Counters of numbers, calls, kernel launches etc. are collected"""
+    STATS_TIMING   = ROCRAND_GENERATOR_STATS_TIMING
+    """Counters are collected and generate calls are timed with HIP events"""
+
     def __init__(self, rngtype, offset=None, stream=None):
         self._gen = c_void_p()
         check_rocrand(rocrand.rocrand_create_generator(byref(self._gen), rngtype))
@@ -140,6 +175,8 @@ class RNG(object):
         if stream is not None:
             self.stream = stream
 
+        self._stats_mode = RNG.STATS_DISABLED
+
     @classmethod
     def _finalize(cls, gen):
         check_rocrand(rocrand.rocrand_destroy_generator(gen))
@@ -171,6 +208,33 @@ class RNG(object):
         check_rocrand(rocrand.rocrand_set_stream(self._gen, stream))
         self._stream = stream
 
+    @property
+    def stats_mode(self):
+        """Mutable attribute of the statistics collection mode of the generator.
+
+        One of :const:`STATS_DISABLED`, :const:`STATS_COUNTERS`,
+        :const:`STATS_TIMING`. Setting this attribute resets statistics.
+        """
+        return self._stats_mode
+
+    @stats_mode.setter
+    def stats_mode(self, mode):
+        check_rocrand(rocrand.rocrand_set_generator_stats(self._gen, mode))
+        self._stats_mode = mode
+
+    def get_stats(self):
+        """Returns statistics of the generator as a dictionary.
+
+        Keys are fields of ``rocrand_generator_stats``: numbers generated
+        per distribution (e.g. ``uniform_numbers``, ``poisson_numbers``),
+        ``generate_calls``, ``kernel_launches``, ``initializations``,
+        ``table_builds`` and ``kernel_time_ms`` (only with :const:`STATS_TIMING`).
+        All values are zero if statistics are disabled (see :attr:`stats_mode`).
+        """
+        stats = rocrand_generator_stats()
+        check_rocrand(rocrand.rocrand_get_generator_stats(self._gen, byref(stats)))
+        return dict((name, getattr(stats, name)) for name, _ in stats._fields_)
+
     def _generate(self, gen_func, ary, size, *args):
         if size is not None:
             if size > ary.size:
@@ -310,6 +374,84 @@ class RNG(object):
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
 
+    def prefetch(self, dtype, size, normal=False, copy=True):
+        """Returns an iterator over buffers of random numbers in host memory.
+
+        Each iteration returns a NumPy array of **size** values, generation
+        and transfer of the next buffer overlap with processing of
+        the current one on the host (see :class:`HostPrefetcher`).
+
+        Supported **dtype**: :class:`numpy.uint32`, :class:`numpy.int32`
+        (uniformly distributed integers), :class:`numpy.float32`,
+        :class:`numpy.float64` (uniformly or standard normally distributed floats).
+
+        The generator must not be used directly while the iterator is used.
+
+        :param dtype:  Type of values
+        :param size:   Number of values in each buffer
+        :param normal: Generate standard normal values instead of uniform
+        :param copy:   Return copies of buffers, if False, returned arrays
+                       are views of pinned host memory which are valid only
+                       until the next iteration
+        """
+        return HostPrefetcher(self, dtype, size, normal=normal, copy=copy)
+
+
+class HostPrefetcher(object):
+    """Iterator over buffers of random numbers in host memory.
+
+    The prefetcher owns two device buffers and two pinned host buffers:
+    while the host processes a buffer, the next one is generated and copied
+    to host memory, so generation and transfer are not serialized.
+
+    Example::
+
+        import rocrand
+        import numpy as np
+
+        gen = rocrand.PRNG(rocrand.PRNG.PHILOX4_32_10, seed=123456)
+        for i, a in zip(range(10), gen.prefetch(np.float32, 1 << 20)):
+            print(a.mean())
+    """
+
+    def __init__(self, rng, dtype, size, normal=False, copy=True):
+        dtype = np.dtype(dtype)
+        if dtype in (np.uint32, np.int32) and not normal:
+            prefetch_type = ROCRAND_PREFETCH_UINT
+        elif dtype == np.float32:
+            prefetch_type = ROCRAND_PREFETCH_NORMAL_FLOAT if normal else ROCRAND_PREFETCH_UNIFORM_FLOAT
+        elif dtype == np.float64:
+            prefetch_type = ROCRAND_PREFETCH_NORMAL_DOUBLE if normal else ROCRAND_PREFETCH_UNIFORM_DOUBLE
+        else:
+            raise TypeError("unsupported type {}".format(dtype))
+
+        # The generator must outlive the prefetcher
+        self._rng = rng
+        self._dtype = dtype
+        self._size = size
+        self._copy = copy
+
+        self._prefetcher = c_void_p()
+        check_rocrand(rocrand.rocrand_create_host_prefetcher(
+            byref(self._prefetcher), rng._gen, prefetch_type, c_size_t(size)))
+        track_for_finalization(self, self._prefetcher, HostPrefetcher._finalize)
+
+    @classmethod
+    def _finalize(cls, prefetcher):
+        check_rocrand(rocrand.rocrand_destroy_host_prefetcher(prefetcher))
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        output = c_void_p()
+        check_rocrand(rocrand.rocrand_host_prefetcher_next(self._prefetcher, byref(output)))
+        buf = (c_char * (self._size * self._dtype.itemsize)).from_address(output.value)
+        ary = np.frombuffer(buf, dtype=self._dtype)
+        return ary.copy() if self._copy else ary
+
+    next = __next__
+
 
 class PRNG(RNG):
     """Pseudo-random number generator.
@@ -164,6 +164,52 @@ class TestParamsQRNG(TestRNGBase):
 make_test(TestParamsQRNG, "DEFAULT", rngtype=QRNG.DEFAULT)
 make_test(TestParamsQRNG, "SOBOL32", rngtype=QRNG.SOBOL32)
 
+class TestStats(TestRNGBase):
+    def setUp(self):
+        super(TestStats, self).setUp()
+        self.rng = self.klass(self.rngtype)
+
+    def tearDown(self):
+        del self.rng
+
+    def test_disabled(self):
+        self.assertEqual(self.rng.stats_mode, self.klass.STATS_DISABLED)
+        self.rng.uniform(np.empty(1000, np.float32))
+        self.assertEqual(self.rng.get_stats()["generate_calls"], 0)
+
+    def test_counters(self):
+        self.rng.stats_mode = self.klass.STATS_COUNTERS
+        self.rng.uniform(np.empty(1000, np.float32))
+        self.rng.poisson(np.empty(1000, np.uint32), 10.0)
+        self.rng.poisson(np.empty(500, np.uint32), 10.0)
+        stats = self.rng.get_stats()
+        self.assertEqual(stats["uniform_numbers"], 1000)
+        self.assertEqual(stats["poisson_numbers"], 1500)
+        self.assertEqual(stats["generate_calls"], 3)
+        self.assertEqual(stats["table_builds"], 1)
+        self.assertGreaterEqual(stats["kernel_launches"], 3)
+
+        self.rng.stats_mode = self.klass.STATS_COUNTERS
+        self.assertEqual(self.rng.get_stats()["generate_calls"], 0)
+
+    def test_timing(self):
+        self.rng.stats_mode = self.klass.STATS_TIMING
+        for i in range(20):
+            self.rng.uniform(empty(1 << 16, np.float32))
+        stats = self.rng.get_stats()
+        self.assertEqual(stats["generate_calls"], 20)
+        self.assertGreater(stats["kernel_time_ms"], 0.0)
+
+    def test_invalid_mode(self):
+        with self.assertRaises(RocRandError):
+            self.rng.stats_mode = 3
+
+make_test(TestStats, "PRNG" + "XORWOW",        klass=PRNG, rngtype=PRNG.XORWOW)
+make_test(TestStats, "PRNG" + "MRG32K3A",      klass=PRNG, rngtype=PRNG.MRG32K3A)
+make_test(TestStats, "PRNG" + "MTGP32",        klass=PRNG, rngtype=PRNG.MTGP32)
+make_test(TestStats, "PRNG" + "PHILOX4_32_10", klass=PRNG, rngtype=PRNG.PHILOX4_32_10)
+make_test(TestStats, "QRNG" + "SOBOL32",       klass=QRNG, rngtype=QRNG.SOBOL32)
+
 OUTPUT_SIZE = 8192
 
 class TestGenerate(TestRNGBase):
@@ -269,6 +315,22 @@ class TestGenerate(TestRNGBase):
         self.assertTrue((output[:OUTPUT_SIZE] <= 1.0).all())
         self.assertTrue((output[OUTPUT_SIZE:] == 10.0).all())
 
+    def test_prefetch(self):
+        size = 4096
+        expected = np.empty(size * 3, np.float32)
+        for i in range(3):
+            self.rng.normal(expected[i * size:(i + 1) * size], 0.0, 1.0)
+
+        rng = self.klass(self.rngtype)
+        prefetcher = rng.prefetch(np.float32, size, normal=True)
+        actual = np.concatenate([next(prefetcher) for i in range(3)])
+        self.assertTrue((expected == actual).all())
+
+        with self.assertRaises(TypeError):
+            self.rng.prefetch(np.int8, size)
+        with self.assertRaises(TypeError):
+            self.rng.prefetch(np.uint32, size, normal=True)
+
 make_test(TestGenerate, "PRNG" + "DEFAULT",       klass=PRNG, rngtype=PRNG.DEFAULT)
 make_test(TestGenerate, "PRNG" + "XORWOW",        klass=PRNG, rngtype=PRNG.XORWOW)
 make_test(TestGenerate, "PRNG" + "MRG32K3A",      klass=PRNG, rngtype=PRNG.MRG32K3A)
@@ -0,0 +1,219 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+#include <rng/distribution/binomial.hpp>
+#include <rng/distribution/negative_binomial.hpp>
+
+template<typename T>
+double get_mean(std::vector<T> values)
+{
+    double mean = 0.0f;
+    for (auto v : values)
+    {
+        mean += static_cast<double>(v);
+    }
+    return mean / values.size();
+}
+
+template<typename T>
+double get_variance(std::vector<T> values, double mean)
+{
+    double variance = 0.0f;
+    for (auto v : values)
+    {
+        const double x = static_cast<double>(v) - mean;
+        variance += x * x;
+    }
+    return variance / values.size();
+}
+
+class binomial_distribution_tests
+    : public ::testing::TestWithParam<std::pair<unsigned int, double>> { };
+
+TEST_P(binomial_distribution_tests, mean_var)
+{
+    const unsigned int trials = GetParam().first;
+    const double probability = GetParam().second;
+    const double expected_mean = trials * probability;
+    const double expected_variance = expected_mean * (1.0 - probability);
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    rocrand_binomial_distribution<ROCRAND_DISCRETE_METHOD_ALIAS, true> dis;
+    dis.set_parameters(trials, probability);
+
+    const size_t samples_count = 1000000;
+    std::vector<unsigned int> values(samples_count);
+
+    for (size_t si = 0; si < samples_count; si++)
+    {
+        const unsigned int v = dis(gen());
+        ASSERT_LE(v, trials);
+        values[si] = v;
+    }
+
+    const double mean = get_mean(values);
+    const double variance = get_variance(values, mean);
+
+    EXPECT_NEAR(mean, expected_mean, std::max(1e-2, expected_mean * 1e-2));
+    EXPECT_NEAR(variance, expected_variance, std::max(1e-2, expected_variance * 2e-2));
+}
+
+TEST_P(binomial_distribution_tests, histogram_compare)
+{
+    const unsigned int trials = GetParam().first;
+    const double probability = GetParam().second;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::binomial_distribution<unsigned int> host_dis(trials, probability);
+
+    rocrand_binomial_distribution<ROCRAND_DISCRETE_METHOD_GUIDE_TABLE, true> dis;
+    dis.set_parameters(trials, probability);
+
+    const size_t samples_count = 1000000;
+    const double stddev = std::sqrt(trials * probability * (1.0 - probability));
+    const size_t bin_size = static_cast<size_t>(std::max(1.0, stddev / 4.0));
+    const size_t bins_count = trials / bin_size + 1;
+    std::vector<unsigned int> historgram0(bins_count);
+    std::vector<unsigned int> historgram1(bins_count);
+
+    for (size_t si = 0; si < samples_count; si++)
+    {
+        historgram0[host_dis(gen) / bin_size]++;
+        historgram1[dis(gen()) / bin_size]++;
+    }
+
+    // Very loose comparison
+    for (size_t bi = 0; bi < bins_count; bi++)
+    {
+        const unsigned int h0 = historgram0[bi];
+        const unsigned int h1 = historgram1[bi];
+        EXPECT_NEAR(h0, h1, std::max(samples_count * 1e-3, std::max(h0, h1) * 1e-1));
+    }
+}
+
+const std::pair<unsigned int, double> binomial_params[] = {
+    { 0, 0.5 }, { 1, 0.5 }, { 10, 0.0 }, { 10, 1.0 }, { 20, 0.3 },
+    { 100, 0.95 }, { 5000, 0.001 }, { 100000, 0.5 }
+};
+
+INSTANTIATE_TEST_CASE_P(binomial_distribution_tests,
+                        binomial_distribution_tests,
+                        ::testing::ValuesIn(binomial_params));
+
+class negative_binomial_distribution_tests
+    : public ::testing::TestWithParam<std::pair<double, double>> { };
+
+TEST_P(negative_binomial_distribution_tests, mean_var)
+{
+    const double successes = GetParam().first;
+    const double probability = GetParam().second;
+    const double expected_mean = successes * (1.0 - probability) / probability;
+    const double expected_variance = expected_mean / probability;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    rocrand_negative_binomial_distribution<ROCRAND_DISCRETE_METHOD_ALIAS, true> dis;
+    dis.set_parameters(successes, probability);
+
+    const size_t samples_count = 1000000;
+    std::vector<unsigned int> values(samples_count);
+
+    for (size_t si = 0; si < samples_count; si++)
+    {
+        values[si] = dis(gen());
+    }
+
+    const double mean = get_mean(values);
+    const double variance = get_variance(values, mean);
+
+    EXPECT_NEAR(mean, expected_mean, std::max(1e-2, expected_mean * 1e-2));
+    EXPECT_NEAR(variance, expected_variance, std::max(1e-2, expected_variance * 3e-2));
+}
+
+TEST_P(negative_binomial_distribution_tests, histogram_compare)
+{
+    const double successes = GetParam().first;
+    const double probability = GetParam().second;
+    if (successes != std::floor(successes))
+    {
+        // std::negative_binomial_distribution supports only integer k
+        return;
+    }
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::negative_binomial_distribution<unsigned int> host_dis(
+        static_cast<unsigned int>(successes), probability
+    );
+
+    rocrand_negative_binomial_distribution<ROCRAND_DISCRETE_METHOD_GUIDE_TABLE, true> dis;
+    dis.set_parameters(successes, probability);
+
+    const size_t samples_count = 1000000;
+    const double mean = successes * (1.0 - probability) / probability;
+    const double stddev = std::sqrt(mean / probability);
+    const size_t bin_size = static_cast<size_t>(std::max(1.0, stddev / 4.0));
+    const size_t bins_count = static_cast<size_t>((mean + 4.0 * stddev + 10.0) / bin_size);
+    std::vector<unsigned int> historgram0(bins_count);
+    std::vector<unsigned int> historgram1(bins_count);
+
+    for (size_t si = 0; si < samples_count; si++)
+    {
+        const size_t bin0 = host_dis(gen) / bin_size;
+        if (bin0 < bins_count)
+        {
+            historgram0[bin0]++;
+        }
+        const size_t bin1 = dis(gen()) / bin_size;
+        if (bin1 < bins_count)
+        {
+            historgram1[bin1]++;
+        }
+    }
+
+    // Very loose comparison
+    for (size_t bi = 0; bi < bins_count; bi++)
+    {
+        const unsigned int h0 = historgram0[bi];
+        const unsigned int h1 = historgram1[bi];
+        EXPECT_NEAR(h0, h1, std::max(samples_count * 1e-3, std::max(h0, h1) * 1e-1));
+    }
+}
+
+const std::pair<double, double> negative_binomial_params[] = {
+    { 1.0, 1.0 }, { 1.0, 0.5 }, { 0.3, 0.2 }, { 5.0, 0.05 }, { 50.0, 0.7 }, { 1000.0, 0.5 }
+};
+
+INSTANTIATE_TEST_CASE_P(negative_binomial_distribution_tests,
+                        negative_binomial_distribution_tests,
+                        ::testing::ValuesIn(negative_binomial_params));
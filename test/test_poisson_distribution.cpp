@@ -125,6 +125,59 @@ TEST_P(poisson_distribution_tests, histogram_compare)
     }
 }
 
+TEST_P(poisson_distribution_tests, guide_table_matches_cdf)
+{
+    const double lambda = GetParam();
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_CDF, true> cdf_dis;
+    cdf_dis.set_lambda(lambda);
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_GUIDE_TABLE, true> guide_dis;
+    guide_dis.set_lambda(lambda);
+
+    // Edge cases and values close to boundaries of guide table intervals
+    const unsigned int size = guide_dis.size;
+    for (unsigned int j = 0; j <= size; j++)
+    {
+        const unsigned long long b = (static_cast<unsigned long long>(j) << 32) / size;
+        for (long long d = -2; d <= 2; d++)
+        {
+            const long long r = static_cast<long long>(b) + d;
+            if (r < 0 || r > UINT_MAX) continue;
+            const unsigned int x = static_cast<unsigned int>(r);
+            ASSERT_EQ(cdf_dis(x), guide_dis(x));
+        }
+    }
+
+    for (size_t si = 0; si < 1000000; si++)
+    {
+        const unsigned int x = gen();
+        ASSERT_EQ(cdf_dis(x), guide_dis(x));
+    }
+}
+
+TEST_P(poisson_distribution_tests, guide_table_null_fallback)
+{
+    const double lambda = GetParam();
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_CDF, true> cdf_dis;
+    cdf_dis.set_lambda(lambda);
+
+    // A struct without a guide table falls back to binary search in CDF
+    rocrand_discrete_distribution_st dis = cdf_dis;
+    ASSERT_EQ(dis.guide, (unsigned int *)NULL);
+    for (size_t si = 0; si < 100000; si++)
+    {
+        const unsigned int x = gen();
+        ASSERT_EQ(cdf_dis(x), rocrand_device::detail::discrete_cdf_guide(x, dis));
+    }
+}
+
 const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 
 INSTANTIATE_TEST_CASE_P(poisson_distribution_tests,
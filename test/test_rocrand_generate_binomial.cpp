@@ -0,0 +1,228 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+class rocrand_generate_binomial_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_binomial_tests, binomial_mean_var_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 65536;
+    const unsigned int trials = 200;
+    const double probability = 0.3;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_binomial(generator, data, size, trials, probability)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> data_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double mean = 0.0;
+    for (auto v : data_host)
+    {
+        ASSERT_LE(v, trials);
+        mean += v;
+    }
+    mean /= size;
+    double variance = 0.0;
+    for (auto v : data_host)
+    {
+        variance += (v - mean) * (v - mean);
+    }
+    variance /= size;
+
+    EXPECT_NEAR(mean, trials * probability, 0.5);
+    EXPECT_NEAR(variance, trials * probability * (1.0 - probability), 4.0);
+}
+
+TEST_P(rocrand_generate_binomial_tests, negative_binomial_mean_var_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 65536;
+    const double successes = 4.5;
+    const double probability = 0.2;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_negative_binomial(generator, data, size, successes, probability)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> data_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double mean = 0.0;
+    for (auto v : data_host)
+    {
+        mean += v;
+    }
+    mean /= size;
+    double variance = 0.0;
+    for (auto v : data_host)
+    {
+        variance += (v - mean) * (v - mean);
+    }
+    variance /= size;
+
+    const double expected_mean = successes * (1.0 - probability) / probability;
+    EXPECT_NEAR(mean, expected_mean, expected_mean * 2e-2);
+    EXPECT_NEAR(variance, expected_mean / probability, expected_mean / probability * 5e-2);
+}
+
+TEST(rocrand_generate_binomial_tests, negative_binomial_tail_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_MRG32K3A
+        )
+    );
+
+    // For small successes the right tail is much longer than the standard
+    // deviation (about 223 here), P(X > 8000) is about 2.3e-6
+    const size_t size = 1 << 22;
+    const double successes = 0.05;
+    const double probability = 0.001;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_negative_binomial(generator, data, size, successes, probability)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> data_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    size_t tail = 0;
+    for (auto v : data_host)
+    {
+        tail += v > 8000;
+    }
+    EXPECT_GT(tail, 0U);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_binomial_tests,
+                        rocrand_generate_binomial_tests,
+                        ::testing::ValuesIn(rng_types));
+
+TEST(rocrand_generate_binomial_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 10, 0.5),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_negative_binomial(generator, data, size, 10.0, 0.5),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+TEST(rocrand_generate_binomial_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_MRG32K3A
+        )
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 10, -0.1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 10, 1.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_negative_binomial(generator, data, size, 0.0, 0.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_negative_binomial(generator, data, size, 10.0, 0.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // Too wide distribution, the table would be too large
+    EXPECT_EQ(
+        rocrand_generate_negative_binomial(generator, data, size, 10.0, 1e-9),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_negative_binomial(generator, data, size, 1e12, 0.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // Rejected parameters do not affect following calls
+    EXPECT_EQ(
+        rocrand_generate_negative_binomial(generator, data, size, 10.0, 0.5),
+        ROCRAND_STATUS_SUCCESS
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
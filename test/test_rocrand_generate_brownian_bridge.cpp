@@ -0,0 +1,279 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template<class T>
+rocrand_status generate_brownian_bridge(rocrand_generator generator,
+                                        T * data, size_t n, T time_step);
+
+template<>
+rocrand_status generate_brownian_bridge(rocrand_generator generator,
+                                        float * data, size_t n, float time_step)
+{
+    return rocrand_generate_brownian_bridge(generator, data, n, time_step);
+}
+
+template<>
+rocrand_status generate_brownian_bridge(rocrand_generator generator,
+                                        double * data, size_t n, double time_step)
+{
+    return rocrand_generate_brownian_bridge_double(generator, data, n, time_step);
+}
+
+template<class T>
+rocrand_status generate_normal(rocrand_generator generator, T * data, size_t n);
+
+template<>
+rocrand_status generate_normal(rocrand_generator generator, float * data, size_t n)
+{
+    return rocrand_generate_normal(generator, data, n, 0.0f, 1.0f);
+}
+
+template<>
+rocrand_status generate_normal(rocrand_generator generator, double * data, size_t n)
+{
+    return rocrand_generate_normal_double(generator, data, n, 0.0, 1.0);
+}
+
+// Generates paths and their normal values (the same points of the sequence)
+template<class T>
+void generate_paths(const unsigned int dimensions,
+                    const size_t paths,
+                    const T time_step,
+                    std::vector<T>& paths_host,
+                    std::vector<T>& normals_host)
+{
+    const size_t size = paths * dimensions;
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    paths_host.resize(size);
+    normals_host.resize(size);
+    for(int normal = 0; normal < 2; normal++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, dimensions));
+        if(normal)
+        {
+            ROCRAND_CHECK(generate_normal(generator, data, size));
+        }
+        else
+        {
+            ROCRAND_CHECK(generate_brownian_bridge(generator, data, size, time_step));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                normal ? normals_host.data() : paths_host.data(),
+                data, size * sizeof(T), hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+    HIP_CHECK(hipFree(data));
+}
+
+// Reference Brownian bridge construction of one path from normal values z
+// (times are 1, 2, ..., z.size())
+std::vector<double> brownian_bridge_path(const std::vector<double>& z)
+{
+    const size_t size = z.size();
+    std::vector<double> path(size, 0.0);
+    std::vector<bool> built(size, false);
+    path[size - 1] = std::sqrt(static_cast<double>(size)) * z[0];
+    built[size - 1] = true;
+    for(size_t i = 1, j = 0; i < size; i++)
+    {
+        while(built[j]) j++;
+        size_t k = j;
+        while(!built[k]) k++;
+        const size_t l = j + ((k - 1 - j) >> 1);
+        const double tl = l + 1.0;
+        const double tk = k + 1.0;
+        const double tj = j;
+        const double left = j == 0 ? 0.0 : path[j - 1];
+        path[l] = ((tk - tl) * left + (tl - tj) * path[k]) / (tk - tj)
+            + std::sqrt((tl - tj) * (tk - tl) / (tk - tj)) * z[i];
+        built[l] = true;
+        j = k + 1;
+        if(j >= size) j = 0;
+    }
+    return path;
+}
+
+template<class T>
+void run_reference_test(const unsigned int dimensions, const T time_step, const double eps)
+{
+    const size_t paths = 1000;
+    std::vector<T> paths_host;
+    std::vector<T> normals_host;
+    generate_paths(dimensions, paths, time_step, paths_host, normals_host);
+
+    for(size_t i = 0; i < paths; i++)
+    {
+        std::vector<double> z(dimensions);
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            z[d] = normals_host[d * paths + i];
+        }
+        const std::vector<double> expected = brownian_bridge_path(z);
+        for(unsigned int t = 0; t < dimensions; t++)
+        {
+            ASSERT_NEAR(
+                paths_host[t * paths + i],
+                std::sqrt(time_step) * expected[t],
+                eps * std::sqrt(time_step * dimensions)
+            ) << "path = " << i << ", step = " << t;
+        }
+    }
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, float_reference_test)
+{
+    const unsigned int dimensions[] = { 1, 2, 7, 64, 100 };
+    for(unsigned int d : dimensions)
+    {
+        SCOPED_TRACE(testing::Message() << "with dimensions = " << d);
+        run_reference_test<float>(d, 0.25f, 1e-4);
+    }
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, double_reference_test)
+{
+    const unsigned int dimensions[] = { 1, 3, 16, 1000 };
+    for(unsigned int d : dimensions)
+    {
+        SCOPED_TRACE(testing::Message() << "with dimensions = " << d);
+        run_reference_test<double>(d, 2.0, 1e-8);
+    }
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, covariance_test)
+{
+    const unsigned int dimensions = 12;
+    const size_t paths = 16384;
+    const double time_step = 0.5;
+    std::vector<double> paths_host;
+    std::vector<double> normals_host;
+    generate_paths(dimensions, paths, time_step, paths_host, normals_host);
+
+    // Cov(W(s), W(t)) = min(s, t), E(W(t)) = 0
+    for(unsigned int s = 0; s < dimensions; s++)
+    {
+        for(unsigned int t = s; t < dimensions; t++)
+        {
+            double c = 0.0;
+            for(size_t i = 0; i < paths; i++)
+            {
+                c += paths_host[s * paths + i] * paths_host[t * paths + i];
+            }
+            c /= paths;
+            const double vs = (s + 1) * time_step;
+            const double vt = (t + 1) * time_step;
+            const double error = std::sqrt((vs * vt + vs * vs) / paths);
+            EXPECT_NEAR(c, vs, 6.0 * error) << "s = " << s << ", t = " << t;
+        }
+    }
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, size, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 4));
+
+    const size_t size = 256;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, (float *)data, size, 0.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge_double(generator, data, size, -1.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge_double(generator, data, size - 1, 1.0),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, pseudo_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 256;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, size, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,266 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+template<class T>
+rocrand_status generate_multivariate_normal(rocrand_generator generator,
+                                            T * data, size_t n_vectors,
+                                            unsigned int dimensions,
+                                            const T * mean, const T * factor);
+
+template<>
+rocrand_status generate_multivariate_normal(rocrand_generator generator,
+                                            float * data, size_t n_vectors,
+                                            unsigned int dimensions,
+                                            const float * mean, const float * factor)
+{
+    return rocrand_generate_multivariate_normal(generator, data, n_vectors, dimensions, mean, factor);
+}
+
+template<>
+rocrand_status generate_multivariate_normal(rocrand_generator generator,
+                                            double * data, size_t n_vectors,
+                                            unsigned int dimensions,
+                                            const double * mean, const double * factor)
+{
+    return rocrand_generate_multivariate_normal_double(generator, data, n_vectors, dimensions, mean, factor);
+}
+
+// Generates vectors and compares their mean and covariance with the expected ones
+template<class T>
+void run_mean_covariance_test(rocrand_rng_type rng_type,
+                              const size_t n_vectors,
+                              const std::vector<T>& mean,
+                              const std::vector<T>& factor)
+{
+    const unsigned int dimensions = mean.size();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    T * data;
+    T * d_mean;
+    T * d_factor;
+    HIP_CHECK(hipMalloc((void **)&data, n_vectors * dimensions * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&d_mean, dimensions * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&d_factor, dimensions * dimensions * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_mean, mean.data(), dimensions * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_factor, factor.data(), dimensions * dimensions * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        generate_multivariate_normal(generator, data, n_vectors, dimensions, d_mean, d_factor)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> data_host(n_vectors * dimensions);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, n_vectors * dimensions * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(d_mean));
+    HIP_CHECK(hipFree(d_factor));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Expected covariance is L * L^T (values above the diagonal of L are ignored)
+    std::vector<double> expected_covariance(dimensions * dimensions, 0.0);
+    for(unsigned int i = 0; i < dimensions; i++)
+    {
+        for(unsigned int j = 0; j < dimensions; j++)
+        {
+            for(unsigned int k = 0; k <= std::min(i, j); k++)
+            {
+                expected_covariance[i * dimensions + j] +=
+                    factor[i * dimensions + k] * factor[j * dimensions + k];
+            }
+        }
+    }
+
+    std::vector<double> data_mean(dimensions, 0.0);
+    for(size_t v = 0; v < n_vectors; v++)
+    {
+        for(unsigned int i = 0; i < dimensions; i++)
+        {
+            data_mean[i] += data_host[v * dimensions + i];
+        }
+    }
+    for(unsigned int i = 0; i < dimensions; i++)
+    {
+        data_mean[i] /= n_vectors;
+        const double expected_stddev = std::sqrt(expected_covariance[i * dimensions + i]);
+        EXPECT_NEAR(data_mean[i], mean[i], 6.0 * expected_stddev / std::sqrt(n_vectors));
+    }
+
+    std::vector<double> data_covariance(dimensions * dimensions, 0.0);
+    for(size_t v = 0; v < n_vectors; v++)
+    {
+        for(unsigned int i = 0; i < dimensions; i++)
+        {
+            for(unsigned int j = 0; j < dimensions; j++)
+            {
+                data_covariance[i * dimensions + j] +=
+                    (data_host[v * dimensions + i] - data_mean[i]) *
+                    (data_host[v * dimensions + j] - data_mean[j]);
+            }
+        }
+    }
+    for(unsigned int i = 0; i < dimensions; i++)
+    {
+        for(unsigned int j = 0; j < dimensions; j++)
+        {
+            const double c = data_covariance[i * dimensions + j] / n_vectors;
+            const double expected = expected_covariance[i * dimensions + j];
+            // Standard error of sample covariance of normal variables
+            const double error = std::sqrt(
+                (expected_covariance[i * dimensions + i] * expected_covariance[j * dimensions + j] +
+                 expected * expected) / n_vectors
+            );
+            EXPECT_NEAR(c, expected, 6.0 * error) << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+class rocrand_generate_multivariate_normal_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_multivariate_normal_tests, float_test)
+{
+    const std::vector<float> mean = { 1.0f, -2.0f, 0.5f };
+    const std::vector<float> factor = {
+        2.0f, 0.0f, 0.0f,
+        1.0f, 1.0f, 0.0f,
+        -0.5f, 0.3f, 0.5f
+    };
+    run_mean_covariance_test<float>(GetParam(), 65536, mean, factor);
+}
+
+TEST_P(rocrand_generate_multivariate_normal_tests, double_test)
+{
+    // Odd number of dimensions that uses the largest kernel,
+    // values above the diagonal must be ignored
+    const unsigned int dimensions = 17;
+    std::vector<double> mean(dimensions);
+    std::vector<double> factor(dimensions * dimensions);
+    for(unsigned int i = 0; i < dimensions; i++)
+    {
+        mean[i] = 0.25 * i - 2.0;
+        for(unsigned int j = 0; j < dimensions; j++)
+        {
+            factor[i * dimensions + j] = i == j ? 1.0 : (j < i ? 0.1 * ((i + j) % 5) - 0.2 : 100.0);
+        }
+    }
+    run_mean_covariance_test<double>(GetParam(), 16384, mean, factor);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_multivariate_normal_tests,
+                        rocrand_generate_multivariate_normal_tests,
+                        ::testing::ValuesIn(rng_types));
+
+TEST(rocrand_generate_multivariate_normal_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, size, 2, data, data),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+TEST(rocrand_generate_multivariate_normal_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 256;
+    const unsigned int max_dimensions = ROCRAND_MULTIVARIATE_NORMAL_MAX_DIMENSIONS;
+    float * data;
+    float * parameters;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&parameters, (max_dimensions + 1) * (max_dimensions + 1) * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 1, 0, parameters, parameters),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 1, max_dimensions + 1, parameters, parameters),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 1, 2, NULL, parameters),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal_double(generator, (double *)data, 1, 2, (double *)parameters, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(parameters));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multivariate_normal_tests, quasi_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+
+    const size_t size = 256;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, size / 2, 2, data, data),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
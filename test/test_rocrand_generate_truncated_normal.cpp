@@ -0,0 +1,231 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+class rocrand_generate_truncated_normal_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_truncated_normal_tests, float_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 65536;
+    const float mean = 1.0f;
+    const float stddev = 2.0f;
+    const float lower = 0.0f;
+    const float upper = 3.0f;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_truncated_normal(generator, data, size, mean, stddev, lower, upper)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> data_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double data_mean = 0.0;
+    for(auto v : data_host)
+    {
+        ASSERT_GE(v, lower);
+        ASSERT_LE(v, upper);
+        data_mean += v;
+    }
+    data_mean /= size;
+
+    // Interval is [-0.5, 1.0] in standard normal units
+    const double a = (lower - mean) / stddev;
+    const double b = (upper - mean) / stddev;
+    const double pdf_a = std::exp(-0.5 * a * a) / std::sqrt(2.0 * M_PI);
+    const double pdf_b = std::exp(-0.5 * b * b) / std::sqrt(2.0 * M_PI);
+    const double z = 0.5 * (std::erfc(-b / std::sqrt(2.0)) - std::erfc(-a / std::sqrt(2.0)));
+    EXPECT_NEAR(data_mean, mean + stddev * (pdf_a - pdf_b) / z, 0.02);
+}
+
+TEST_P(rocrand_generate_truncated_normal_tests, double_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 65536;
+    const double mean = 0.0;
+    const double stddev = 1.0;
+    const double lower = 5.0;
+    const double upper = 7.0;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_truncated_normal_double(generator, data, size, mean, stddev, lower, upper)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> data_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double data_mean = 0.0;
+    for(auto v : data_host)
+    {
+        ASSERT_GE(v, lower);
+        ASSERT_LE(v, upper);
+        data_mean += v;
+    }
+    data_mean /= size;
+
+    // Far tail: the mean is close to the inverse Mills ratio of lower bound
+    const double pdf_a = std::exp(-0.5 * lower * lower) / std::sqrt(2.0 * M_PI);
+    const double pdf_b = std::exp(-0.5 * upper * upper) / std::sqrt(2.0 * M_PI);
+    const double z = 0.5 * (std::erfc(lower / std::sqrt(2.0)) - std::erfc(upper / std::sqrt(2.0)));
+    EXPECT_NEAR(data_mean, (pdf_a - pdf_b) / z, 0.01);
+}
+
+TEST_P(rocrand_generate_truncated_normal_tests, far_tail_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 65536;
+    float * data;
+    double * data_double;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data_double, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // CDF underflows in float
+    const float lower = -15.0f;
+    const float upper = -14.0f;
+    ROCRAND_CHECK(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, lower, upper)
+    );
+    // CDF underflows in double
+    const double lower_double = 40.0;
+    const double upper_double = 41.0;
+    ROCRAND_CHECK(
+        rocrand_generate_truncated_normal_double(generator, data_double, size, 0.0, 1.0,
+                                                 lower_double, upper_double)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> data_host(size);
+    std::vector<double> data_double_host(size);
+    HIP_CHECK(hipMemcpy(data_host.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(data_double_host.data(), data_double, size * sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_double));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double data_mean = 0.0;
+    for(auto v : data_host)
+    {
+        ASSERT_GE(v, lower);
+        ASSERT_LE(v, upper);
+        data_mean += v;
+    }
+    data_mean /= size;
+    double data_double_mean = 0.0;
+    for(auto v : data_double_host)
+    {
+        ASSERT_GE(v, lower_double);
+        ASSERT_LE(v, upper_double);
+        data_double_mean += v;
+    }
+    data_double_mean /= size;
+
+    // Values are not collapsed to a bound: the mean is close to
+    // a + 1 / a - 2 / a^3 (asymptotic inverse Mills ratio of the closer bound a)
+    EXPECT_NEAR(data_mean, -(14.0 + 1.0 / 14.0 - 2.0 / (14.0 * 14.0 * 14.0)), 0.005);
+    EXPECT_NEAR(data_double_mean, 40.0 + 1.0 / 40.0 - 2.0 / (40.0 * 40.0 * 40.0), 0.001);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_truncated_normal_tests,
+                        rocrand_generate_truncated_normal_tests,
+                        ::testing::ValuesIn(rng_types));
+
+TEST(rocrand_generate_truncated_normal_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, -1.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+TEST(rocrand_generate_truncated_normal_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 256;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // stddev must be positive
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 0.0f, -1.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // lower must be less than upper
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, 1.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal_double(generator, (double *)data, size / 2, 0.0, 1.0, 2.0, -2.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
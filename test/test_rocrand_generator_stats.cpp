@@ -0,0 +1,193 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+class rocrand_generator_stats_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST(rocrand_generator_stats_tests, invalid_arguments)
+{
+    rocrand_generator_stats stats;
+    EXPECT_EQ(rocrand_set_generator_stats(NULL, ROCRAND_GENERATOR_STATS_COUNTERS), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_get_generator_stats(NULL, &stats), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_get_generator_stats(generator, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(
+        rocrand_set_generator_stats(generator, static_cast<rocrand_generator_stats_mode>(3)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generator_stats_tests, disabled)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 1024;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, size * sizeof(float)));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator_stats stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.uniform_numbers, 0ULL);
+    EXPECT_EQ(stats.generate_calls, 0ULL);
+    EXPECT_EQ(stats.kernel_launches, 0ULL);
+    EXPECT_EQ(stats.initializations, 0ULL);
+    EXPECT_EQ(stats.kernel_time_ms, 0.0);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generator_stats_tests, counters)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_generator_stats(generator, ROCRAND_GENERATOR_STATS_COUNTERS));
+
+    const size_t size = 1024;
+    float * data;
+    unsigned int * uints;
+    HIP_CHECK(hipMalloc(&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc(&uints, size * sizeof(unsigned int)));
+
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    ROCRAND_CHECK(rocrand_generate(generator, uints, size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 0.0f, 1.0f));
+    // Tables are computed only when lambda is changed
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, uints, size, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, uints, size, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, uints, size, 20.0));
+    // The state is reinitialized after the seed or offset is changed
+    if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_set_offset(generator, 12345ULL));
+    }
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size / 2));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator_stats stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.uniform_numbers, size * 2 + size / 2);
+    EXPECT_EQ(stats.normal_numbers, size);
+    EXPECT_EQ(stats.poisson_numbers, size * 3);
+    EXPECT_EQ(stats.log_normal_numbers, 0ULL);
+    EXPECT_EQ(stats.generate_calls, 7ULL);
+    EXPECT_GE(stats.kernel_launches, 7ULL);
+    EXPECT_EQ(stats.table_builds, 2ULL);
+    EXPECT_EQ(stats.initializations, 2ULL);
+    EXPECT_EQ(stats.kernel_time_ms, 0.0);
+
+    // Failed calls are not counted
+    const rocrand_status status = rocrand_generate_brownian_bridge(generator, data, size, 0.1f);
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        EXPECT_EQ(stats.brownian_bridge_numbers, size);
+        EXPECT_EQ(stats.generate_calls, 8ULL);
+    }
+    else
+    {
+        EXPECT_EQ(stats.brownian_bridge_numbers, 0ULL);
+        EXPECT_EQ(stats.generate_calls, 7ULL);
+    }
+
+    // Statistics are reset when the mode is set
+    ROCRAND_CHECK(rocrand_set_generator_stats(generator, ROCRAND_GENERATOR_STATS_COUNTERS));
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.uniform_numbers, 0ULL);
+    EXPECT_EQ(stats.generate_calls, 0ULL);
+    EXPECT_EQ(stats.table_builds, 0ULL);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(uints));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generator_stats_tests, timing)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+    ROCRAND_CHECK(rocrand_set_generator_stats(generator, ROCRAND_GENERATOR_STATS_TIMING));
+
+    const size_t size = 1 << 16;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, size * sizeof(float)));
+
+    // More calls than the generator has pairs of events
+    const unsigned long long calls = 40;
+    for(unsigned long long i = 0; i < calls; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    }
+
+    rocrand_generator_stats stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.uniform_numbers, calls * size);
+    EXPECT_EQ(stats.generate_calls, calls);
+    EXPECT_GT(stats.kernel_time_ms, 0.0);
+
+    // Queried calls are not accumulated again
+    rocrand_generator_stats stats2;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats2));
+    EXPECT_EQ(stats2.kernel_time_ms, stats.kernel_time_ms);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generator_stats_tests,
+                        rocrand_generator_stats_tests,
+                        ::testing::ValuesIn(rng_types));
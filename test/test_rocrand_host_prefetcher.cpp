@@ -0,0 +1,214 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+const rocrand_prefetch_type prefetch_types[] = {
+    ROCRAND_PREFETCH_UINT,
+    ROCRAND_PREFETCH_UNIFORM_FLOAT,
+    ROCRAND_PREFETCH_UNIFORM_DOUBLE,
+    ROCRAND_PREFETCH_NORMAL_FLOAT,
+    ROCRAND_PREFETCH_NORMAL_DOUBLE
+};
+
+size_t get_value_size(rocrand_prefetch_type type)
+{
+    return type == ROCRAND_PREFETCH_UNIFORM_DOUBLE || type == ROCRAND_PREFETCH_NORMAL_DOUBLE
+        ? sizeof(double) : sizeof(unsigned int);
+}
+
+rocrand_status generate(rocrand_generator generator, rocrand_prefetch_type type,
+                        void * data, size_t size)
+{
+    switch(type)
+    {
+        case ROCRAND_PREFETCH_UINT:
+            return rocrand_generate(generator, static_cast<unsigned int *>(data), size);
+        case ROCRAND_PREFETCH_UNIFORM_FLOAT:
+            return rocrand_generate_uniform(generator, static_cast<float *>(data), size);
+        case ROCRAND_PREFETCH_UNIFORM_DOUBLE:
+            return rocrand_generate_uniform_double(generator, static_cast<double *>(data), size);
+        case ROCRAND_PREFETCH_NORMAL_FLOAT:
+            return rocrand_generate_normal(generator, static_cast<float *>(data), size, 0.0f, 1.0f);
+        case ROCRAND_PREFETCH_NORMAL_DOUBLE:
+            return rocrand_generate_normal_double(generator, static_cast<double *>(data), size, 0.0, 1.0);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+class rocrand_host_prefetcher_tests
+    : public ::testing::TestWithParam<std::tuple<rocrand_rng_type, rocrand_prefetch_type>> { };
+
+TEST_P(rocrand_host_prefetcher_tests, same_as_generate_test)
+{
+    const rocrand_rng_type rng_type = std::get<0>(GetParam());
+    const rocrand_prefetch_type type = std::get<1>(GetParam());
+    const size_t size = 12346;
+    const size_t buffers = 5;
+    const size_t bytes = size * get_value_size(type);
+
+    // Results of consecutive generate calls
+    std::vector<char> expected(bytes * buffers);
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        void * data;
+        HIP_CHECK(hipMalloc(&data, bytes));
+        for(size_t b = 0; b < buffers; b++)
+        {
+            ROCRAND_CHECK(generate(generator, type, data, size));
+            HIP_CHECK(hipMemcpy(expected.data() + b * bytes, data, bytes, hipMemcpyDeviceToHost));
+        }
+        HIP_CHECK(hipFree(data));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    std::vector<char> actual(bytes * buffers);
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        rocrand_host_prefetcher prefetcher;
+        ROCRAND_CHECK(rocrand_create_host_prefetcher(&prefetcher, generator, type, size));
+        const void * previous = NULL;
+        for(size_t b = 0; b < buffers; b++)
+        {
+            const void * output;
+            ROCRAND_CHECK(rocrand_host_prefetcher_next(prefetcher, &output));
+            ASSERT_NE(output, previous);
+            std::memcpy(actual.data() + b * bytes, output, bytes);
+            previous = output;
+        }
+        ROCRAND_CHECK(rocrand_destroy_host_prefetcher(prefetcher));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    ASSERT_EQ(std::memcmp(expected.data(), actual.data(), expected.size()), 0);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_host_prefetcher_tests,
+                        rocrand_host_prefetcher_tests,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(rng_types),
+                            ::testing::ValuesIn(prefetch_types)));
+
+TEST(rocrand_host_prefetcher_tests, arguments_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    rocrand_host_prefetcher prefetcher;
+    EXPECT_EQ(
+        rocrand_create_host_prefetcher(&prefetcher, NULL, ROCRAND_PREFETCH_UINT, 1024),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_create_host_prefetcher(&prefetcher, generator, ROCRAND_PREFETCH_UINT, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_host_prefetcher(&prefetcher, generator, static_cast<rocrand_prefetch_type>(100), 1024),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    // Philox generates normal values in pairs
+    EXPECT_EQ(
+        rocrand_create_host_prefetcher(&prefetcher, generator, ROCRAND_PREFETCH_NORMAL_FLOAT, 1025),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    EXPECT_EQ(
+        rocrand_create_host_prefetcher(&prefetcher, generator, ROCRAND_PREFETCH_NORMAL_DOUBLE, 1025),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    ROCRAND_CHECK(rocrand_create_host_prefetcher(&prefetcher, generator, ROCRAND_PREFETCH_UINT, 1025));
+    const void * output;
+    ROCRAND_CHECK(rocrand_host_prefetcher_next(prefetcher, &output));
+    ROCRAND_CHECK(rocrand_destroy_host_prefetcher(prefetcher));
+
+    rocrand_generator sobol_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&sobol_generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(sobol_generator, 4));
+    EXPECT_EQ(
+        rocrand_create_host_prefetcher(&prefetcher, sobol_generator, ROCRAND_PREFETCH_UNIFORM_FLOAT, 1026),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(sobol_generator));
+
+    EXPECT_EQ(rocrand_host_prefetcher_next(NULL, &output), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_destroy_host_prefetcher(NULL), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_host_prefetcher_tests, cpp_wrapper_test)
+{
+    const size_t size = 4096;
+
+    std::vector<float> expected(size * 3);
+    {
+        rocrand_cpp::philox4x32_10_engine<> engine;
+        rocrand_cpp::normal_distribution<float> distribution;
+        float * data;
+        HIP_CHECK(hipMalloc(&data, size * sizeof(float)));
+        for(size_t b = 0; b < 3; b++)
+        {
+            distribution(engine, data, size);
+            HIP_CHECK(hipMemcpy(expected.data() + b * size, data, size * sizeof(float), hipMemcpyDeviceToHost));
+        }
+        HIP_CHECK(hipFree(data));
+    }
+
+    std::vector<float> actual;
+    {
+        rocrand_cpp::philox4x32_10_engine<> engine;
+        rocrand_cpp::host_prefetcher<float> prefetcher(engine, size, true);
+        ASSERT_EQ(prefetcher.size(), size);
+        for(size_t b = 0; b < 3; b++)
+        {
+            const float * output = prefetcher.next();
+            actual.insert(actual.end(), output, output + size);
+        }
+    }
+
+    ASSERT_EQ(expected, actual);
+
+    rocrand_cpp::xorwow_engine<> engine;
+    ASSERT_THROW(rocrand_cpp::host_prefetcher<unsigned int>(engine, size, true), rocrand_cpp::error);
+}
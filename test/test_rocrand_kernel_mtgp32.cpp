@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include <vector>
+#include <utility>
 #include <cmath>
 
 #include <hip/hip_runtime.h>
@@ -179,6 +180,100 @@ void rocrand_poisson_kernel(GeneratorState * states, unsigned int * output, cons
         states[state_id] = state;
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_binomial_kernel(GeneratorState * states, unsigned int * output, const size_t size, unsigned int trials, double probability)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+    const unsigned int thread_id = hipThreadIdx_x;
+    unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    __shared__ GeneratorState state;
+    if (thread_id == 0)
+        state = states[state_id];
+    __syncthreads();
+
+    const size_t r = size%hipBlockDim_x;
+    const size_t size_rounded_up = r == 0 ? size : size + (hipBlockDim_x - r);
+    while(index < size_rounded_up)
+    {
+        auto value = rocrand_binomial(&state, trials, probability);
+        if(index < size)
+            output[index] = value;
+        // Next position
+        index += stride;
+    }
+
+    // Save engine with its state
+    if (thread_id == 0)
+        states[state_id] = state;
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_negative_binomial_kernel(GeneratorState * states, unsigned int * output, const size_t size, double successes, double probability)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+    const unsigned int thread_id = hipThreadIdx_x;
+    unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    __shared__ GeneratorState state;
+    if (thread_id == 0)
+        state = states[state_id];
+    __syncthreads();
+
+    const size_t r = size%hipBlockDim_x;
+    const size_t size_rounded_up = r == 0 ? size : size + (hipBlockDim_x - r);
+    while(index < size_rounded_up)
+    {
+        auto value = rocrand_negative_binomial(&state, successes, probability);
+        if(index < size)
+            output[index] = value;
+        // Next position
+        index += stride;
+    }
+
+    // Save engine with its state
+    if (thread_id == 0)
+        states[state_id] = state;
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_truncated_normal_kernel(GeneratorState * states, double * output, const size_t size, double a, double b, bool use_double)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+    const unsigned int thread_id = hipThreadIdx_x;
+    unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    __shared__ GeneratorState state;
+    if (thread_id == 0)
+        state = states[state_id];
+    __syncthreads();
+
+    const size_t r = size%hipBlockDim_x;
+    const size_t size_rounded_up = r == 0 ? size : size + (hipBlockDim_x - r);
+    while(index < size_rounded_up)
+    {
+        double value;
+        if(use_double)
+            value = rocrand_truncated_normal_double(&state, a, b);
+        else
+            value = rocrand_truncated_normal(&state, static_cast<float>(a), static_cast<float>(b));
+        if(index < size)
+            output[index] = value;
+        // Next position
+        index += stride;
+    }
+
+    // Save engine with its state
+    if (thread_id == 0)
+        states[state_id] = state;
+}
+
 TEST(rocrand_kernel_mtgp32, rocrand_state_mtgp32_type)
 {
     EXPECT_EQ(sizeof(rocrand_state_mtgp32), 1078 * sizeof(unsigned int));
@@ -433,3 +528,203 @@ const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 INSTANTIATE_TEST_CASE_P(rocrand_kernel_mtgp32_poisson,
                         rocrand_kernel_mtgp32_poisson,
                         ::testing::ValuesIn(lambdas));
+
+TEST(rocrand_kernel_mtgp32, rocrand_binomial)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    const std::pair<unsigned int, double> test_params[] = {
+        { 10, 0.5 }, { 50, 0.9 }, { 1000, 0.02 }, { 1000, 0.3 }, { 1000000, 0.7 }
+    };
+    for(auto params : test_params)
+    {
+        const unsigned int trials = params.first;
+        const double probability = params.second;
+        const double expected_mean = trials * probability;
+        const double expected_variance = trials * probability * (1.0 - probability);
+
+        state_type * states;
+        hipMalloc(&states, sizeof(state_type) * 8);
+
+        ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+
+        const size_t output_size = 8192;
+        unsigned int * output;
+        HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_binomial_kernel<state_type>),
+            dim3(8), dim3(256), 0, 0,
+            states, output, output_size, trials, probability
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<unsigned int> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(output));
+        HIP_CHECK(hipFree(states));
+
+        double mean = 0;
+        for(auto v : output_host)
+        {
+            mean += static_cast<double>(v);
+        }
+        mean = mean / output_size;
+
+        double variance = 0;
+        for(auto v : output_host)
+        {
+            variance += std::pow(v - mean, 2);
+        }
+        variance = variance / output_size;
+
+        EXPECT_NEAR(mean, expected_mean, std::max(1.0, expected_mean * 1e-1));
+        EXPECT_NEAR(variance, expected_variance, std::max(1.0, expected_variance * 1e-1));
+    }
+}
+
+TEST(rocrand_kernel_mtgp32, rocrand_negative_binomial)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    const std::pair<double, double> test_params[] = {
+        { 1.0, 0.5 }, { 2.5, 0.1 }, { 20.0, 0.8 }, { 100.0, 0.3 }, { 1.5, 0.05 }
+    };
+    for(auto params : test_params)
+    {
+        const double successes = params.first;
+        const double probability = params.second;
+        const double expected_mean = successes * (1.0 - probability) / probability;
+        const double expected_variance = expected_mean / probability;
+
+        state_type * states;
+        hipMalloc(&states, sizeof(state_type) * 8);
+
+        ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+
+        const size_t output_size = 8192;
+        unsigned int * output;
+        HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_negative_binomial_kernel<state_type>),
+            dim3(8), dim3(256), 0, 0,
+            states, output, output_size, successes, probability
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<unsigned int> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(output));
+        HIP_CHECK(hipFree(states));
+
+        double mean = 0;
+        for(auto v : output_host)
+        {
+            mean += static_cast<double>(v);
+        }
+        mean = mean / output_size;
+
+        double variance = 0;
+        for(auto v : output_host)
+        {
+            variance += std::pow(v - mean, 2);
+        }
+        variance = variance / output_size;
+
+        EXPECT_NEAR(mean, expected_mean, std::max(1.0, expected_mean * 1e-1));
+        EXPECT_NEAR(variance, expected_variance, std::max(1.0, expected_variance * 1e-1));
+    }
+}
+
+TEST(rocrand_kernel_mtgp32, rocrand_truncated_normal)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    // Bounds of standard normal distribution, the last ones use tail
+    // sampling for pseudo-random generators
+    const std::pair<double, double> test_params[] = {
+        { -1.0, 1.0 }, { 0.0, 2.0 }, { -2.0, 10.0 }, { 3.5, 4.5 }, { -7.0, -5.0 }, { 6.0, 100.0 }
+    };
+    for(bool use_double : { false, true })
+    {
+        for(auto params : test_params)
+        {
+            const double a = params.first;
+            const double b = params.second;
+            const double pdf_a = std::exp(-0.5 * a * a) / std::sqrt(2.0 * M_PI);
+            const double pdf_b = std::exp(-0.5 * b * b) / std::sqrt(2.0 * M_PI);
+            // Avoid cancellation in the upper tail
+            const double z = a > 0.0
+                ? 0.5 * (std::erfc(a / std::sqrt(2.0)) - std::erfc(b / std::sqrt(2.0)))
+                : 0.5 * (std::erfc(-b / std::sqrt(2.0)) - std::erfc(-a / std::sqrt(2.0)));
+            const double expected_mean = (pdf_a - pdf_b) / z;
+            const double expected_stddev =
+                std::sqrt(1.0 + (a * pdf_a - b * pdf_b) / z - expected_mean * expected_mean);
+
+            state_type * states;
+            hipMalloc(&states, sizeof(state_type) * 8);
+
+            ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+
+            const size_t output_size = 8192;
+            double * output;
+            HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(double)));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_truncated_normal_kernel<state_type>),
+                dim3(8), dim3(256), 0, 0,
+                states, output, output_size, a, b, use_double
+            );
+            HIP_CHECK(hipPeekAtLastError());
+
+            std::vector<double> output_host(output_size);
+            HIP_CHECK(
+                hipMemcpy(
+                    output_host.data(), output,
+                    output_size * sizeof(double),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(output));
+            HIP_CHECK(hipFree(states));
+
+            double mean = 0;
+            for(auto v : output_host)
+            {
+                ASSERT_GE(v, use_double ? a : static_cast<float>(a));
+                ASSERT_LE(v, use_double ? b : static_cast<float>(b));
+                mean += v;
+            }
+            mean = mean / output_size;
+
+            double stddev = 0;
+            for(auto v : output_host)
+            {
+                stddev += std::pow(v - mean, 2);
+            }
+            stddev = std::sqrt(stddev / output_size);
+
+            EXPECT_NEAR(mean, expected_mean, expected_stddev * 1e-1);
+            EXPECT_NEAR(stddev, expected_stddev, expected_stddev * 1e-1);
+        }
+    }
+}
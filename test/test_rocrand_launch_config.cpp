@@ -0,0 +1,161 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+using rocrand_host::detail::launch_config;
+using rocrand_host::detail::launch_config_limits;
+using rocrand_host::detail::get_launch_config;
+
+// Writes the tuning file and sets the environment variable,
+// the variable is removed when the object is destroyed
+class tuning_file
+{
+public:
+    tuning_file(const std::string& contents)
+        : path("rocrand_test_tuning.txt")
+    {
+        std::ofstream file(path.c_str());
+        file << contents;
+        file.close();
+        setenv(ROCRAND_TUNING_FILE_ENV, path.c_str(), 1);
+    }
+
+    ~tuning_file()
+    {
+        unsetenv(ROCRAND_TUNING_FILE_ENV);
+        remove(path.c_str());
+    }
+
+private:
+    std::string path;
+};
+
+TEST(rocrand_launch_config_tests, default_test)
+{
+    const launch_config default_config = { 256, 512 };
+    const launch_config_limits limits = { 1024, 32, 65535, 1 };
+
+    unsetenv(ROCRAND_TUNING_FILE_ENV);
+    launch_config config = get_launch_config("xorwow", default_config, limits);
+    EXPECT_EQ(config.threads, default_config.threads);
+    EXPECT_EQ(config.blocks, default_config.blocks);
+
+    // The file does not exist
+    setenv(ROCRAND_TUNING_FILE_ENV, "rocrand_test_tuning_does_not_exist.txt", 1);
+    config = get_launch_config("xorwow", default_config, limits);
+    EXPECT_EQ(config.threads, default_config.threads);
+    EXPECT_EQ(config.blocks, default_config.blocks);
+    unsetenv(ROCRAND_TUNING_FILE_ENV);
+}
+
+TEST(rocrand_launch_config_tests, file_test)
+{
+    const std::string device_name = rocrand_host::detail::get_device_name();
+    const launch_config default_config = { 256, 512 };
+    const launch_config_limits limits = { 1024, 32, 4096, 16 };
+
+    tuning_file file(
+        "# engine threads blocks device\n"
+        "\n"
+        "xorwow 128 64 " + device_name + "\n"
+        "xorwow 64 32 " + device_name + "\r\n"
+        "mrg32k3a 128 64 " + device_name + "\n"
+        "philox 128 64 other device\n"
+        "philox 100 64 " + device_name + "\n"
+        "philox 128 8 " + device_name + "\n"
+        "philox 128 8192 " + device_name + "\n"
+        "philox 2048 64 " + device_name + "\n"
+        "philox\n"
+    );
+
+    // The last entry is used
+    launch_config config = get_launch_config("xorwow", default_config, limits);
+    EXPECT_EQ(config.threads, 64U);
+    EXPECT_EQ(config.blocks, 32U);
+
+    config = get_launch_config("mrg32k3a", default_config, limits);
+    EXPECT_EQ(config.threads, 128U);
+    EXPECT_EQ(config.blocks, 64U);
+
+    // Entries of other devices and invalid entries are ignored
+    config = get_launch_config("philox", default_config, limits);
+    EXPECT_EQ(config.threads, default_config.threads);
+    EXPECT_EQ(config.blocks, default_config.blocks);
+
+    config = get_launch_config("sobol32", default_config, limits);
+    EXPECT_EQ(config.threads, default_config.threads);
+    EXPECT_EQ(config.blocks, default_config.blocks);
+}
+
+template<class Generator>
+void run_tuned_generator_test(const std::string& engine)
+{
+    const std::string device_name = rocrand_host::detail::get_device_name();
+    tuning_file file(engine + " 256 16 " + device_name + "\n");
+
+    const size_t size = 12345;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    Generator g;
+    ROCRAND_CHECK(g.generate_uniform(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_launch_config_tests, tuned_generator_test)
+{
+    run_tuned_generator_test<rocrand_xorwow>("xorwow");
+    run_tuned_generator_test<rocrand_mrg32k3a>("mrg32k3a");
+    run_tuned_generator_test<rocrand_philox4x32_10>("philox");
+    run_tuned_generator_test<rocrand_mtgp32>("mtgp32");
+    run_tuned_generator_test<rocrand_sobol32>("sobol32");
+}
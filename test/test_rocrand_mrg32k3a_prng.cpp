@@ -21,6 +21,8 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -262,6 +264,50 @@ TEST(rocrand_mrg32k3a_prng_tests, state_progress_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Checks if a small generate() call uses and changes states of the first engines
+// only: numbers generated by other engines in the next call must be the same as
+// numbers generated by a new generator
+TEST(rocrand_mrg32k3a_prng_tests, partial_grid_test)
+{
+    const size_t small_size = 100;
+    const size_t size = 4096;
+    // Numbers with indices less than changed_size are generated by engines used by the first call
+    const size_t changed_size = small_size;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_mrg32k3a g0;
+    rocrand_mrg32k3a g1;
+
+    ROCRAND_CHECK(g0.generate(data, small_size));
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data0[size];
+    HIP_CHECK(hipMemcpy(host_data0, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data1[size];
+    HIP_CHECK(hipMemcpy(host_data1, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < changed_size; i++)
+    {
+        if(host_data0[i] == host_data1[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.1f * changed_size));
+    for(size_t i = changed_size; i < size; i++)
+    {
+        ASSERT_EQ(host_data0[i], host_data1[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
 // Checks if generators with the same seed and in the same state
 // generate the same numbers
 TEST(rocrand_mrg32k3a_prng_tests, same_seed_test)
@@ -352,6 +398,89 @@ TEST(rocrand_mrg32k3a_prng_tests, different_seed_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Checks that values are saved with the same mapping to engines for aligned
+// and unaligned output and for all sizes of the tail: with portable ordering
+// value i is generated by engine i / 4 as its (i % 4)-th value
+TEST(rocrand_mrg32k3a_prng_tests, vector_store_test)
+{
+    const unsigned long long seed = 1234567ULL;
+    const size_t sizes[] = { 1, 2, 3, 4, 5, 6, 7, 8, 4097, 12346, 12347 };
+    const size_t max_size = 12347;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * (max_size + 1)));
+
+    std::vector<unsigned int> expected(max_size);
+    for(size_t i = 0; i < max_size; i++)
+    {
+        rocrand_mrg32k3a::engine_type engine(seed, i / 4, 0);
+        engine.discard(i % 4);
+        expected[i] = mrg_uniform_distribution<unsigned int>()(engine());
+    }
+
+    for(size_t size : sizes)
+    {
+        // The second offset makes output unaligned
+        for(size_t offset = 0; offset < 2; offset++)
+        {
+            // Small requests use all launched threads, so vector j is
+            // generated by engine j
+            rocrand_mrg32k3a g;
+            g.set_seed(seed);
+            ROCRAND_CHECK(g.generate(data + offset, size));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> host_data(size);
+            HIP_CHECK(hipMemcpy(host_data.data(), data + offset, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(host_data[i], expected[i]) << "size " << size << ", offset " << offset << ", index " << i;
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// The portable ordering keeps the mapping of single values to engines
+TEST(rocrand_mrg32k3a_prng_tests, portable_mapping_test)
+{
+    const unsigned long long seed = 1234567ULL;
+    const size_t sizes[] = { 1, 3, 4, 5, 4097, 12347 };
+    const size_t max_size = 12347;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * (max_size + 1)));
+
+    std::vector<unsigned int> expected(max_size);
+    for(size_t i = 0; i < max_size; i++)
+    {
+        rocrand_mrg32k3a::engine_type engine(seed, i, 0);
+        expected[i] = mrg_uniform_distribution<unsigned int>()(engine());
+    }
+
+    for(size_t size : sizes)
+    {
+        for(size_t offset = 0; offset < 2; offset++)
+        {
+            rocrand_mrg32k3a g;
+            g.set_seed(seed);
+            ROCRAND_CHECK(g.set_order(ROCRAND_ORDERING_PSEUDO_PORTABLE));
+            ROCRAND_CHECK(g.generate(data + offset, size));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<unsigned int> host_data(size);
+            HIP_CHECK(hipMemcpy(host_data.data(), data + offset, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(host_data[i], expected[i]) << "size " << size << ", offset " << offset << ", index " << i;
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
 TEST(rocrand_mrg32k3a_prng_tests, discard_test)
 {
     const unsigned long long seed = 12345ULL;
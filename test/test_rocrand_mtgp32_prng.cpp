@@ -192,6 +192,50 @@ TEST(rocrand_mtgp32_prng_tests, state_progress_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Checks if a small generate() call uses and changes states of the first engines
+// only: numbers generated by other engines in the next call must be the same as
+// numbers generated by a new generator
+TEST(rocrand_mtgp32_prng_tests, partial_grid_test)
+{
+    const size_t small_size = 100;
+    const size_t size = 4096;
+    // Numbers with indices less than changed_size are generated by the first block (engine) used by the first call
+    const size_t changed_size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_mtgp32 g0;
+    rocrand_mtgp32 g1;
+
+    ROCRAND_CHECK(g0.generate(data, small_size));
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data0[size];
+    HIP_CHECK(hipMemcpy(host_data0, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data1[size];
+    HIP_CHECK(hipMemcpy(host_data1, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < changed_size; i++)
+    {
+        if(host_data0[i] == host_data1[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.1f * changed_size));
+    for(size_t i = changed_size; i < size; i++)
+    {
+        ASSERT_EQ(host_data0[i], host_data1[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
 // Checks if generators with the same seed and in the same state
 // generate the same numbers
 TEST(rocrand_mtgp32_prng_tests, same_seed_test)
@@ -0,0 +1,234 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Writes the tuning file and sets the environment variable,
+// the variable is removed when the object is destroyed
+class tuning_file
+{
+public:
+    tuning_file(const std::string& contents)
+        : path("rocrand_test_ordering_tuning.txt")
+    {
+        std::ofstream file(path.c_str());
+        file << contents;
+        file.close();
+        setenv(ROCRAND_TUNING_FILE_ENV, path.c_str(), 1);
+    }
+
+    ~tuning_file()
+    {
+        unsetenv(ROCRAND_TUNING_FILE_ENV);
+        remove(path.c_str());
+    }
+
+private:
+    std::string path;
+};
+
+TEST(rocrand_ordering_tests, set_ordering_test)
+{
+    EXPECT_EQ(
+        rocrand_set_ordering(NULL, ROCRAND_ORDERING_PSEUDO_PORTABLE),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    const rocrand_rng_type pseudo_types[] = {
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+        ROCRAND_RNG_PSEUDO_MTGP32
+    };
+    for(auto rng_type : pseudo_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        EXPECT_EQ(
+            rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_PORTABLE),
+            ROCRAND_STATUS_SUCCESS
+        );
+        EXPECT_EQ(
+            rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_DEFAULT),
+            ROCRAND_STATUS_SUCCESS
+        );
+        EXPECT_EQ(
+            rocrand_set_ordering(generator, ROCRAND_ORDERING_QUASI_DEFAULT),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_SUCCESS
+    );
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_PORTABLE),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+struct grid_shape
+{
+    unsigned int threads;
+    unsigned int blocks;
+};
+
+// Generates a sequence of results of different types and sizes (including
+// sizes greater than the number of logical threads and sizes which are not
+// multiples of vector sizes used by kernels) with launch parameters
+// from the tuning file
+void generate_sequence(rocrand_rng_type rng_type,
+                       const std::string& engine,
+                       const grid_shape& shape,
+                       std::vector<unsigned int>& host_uints,
+                       std::vector<float>& host_floats,
+                       std::vector<double>& host_doubles)
+{
+    std::stringstream contents;
+    contents << engine << " " << shape.threads << " " << shape.blocks << " "
+             << rocrand_host::detail::get_device_name() << "\n";
+    tuning_file file(contents.str());
+
+    const size_t uints_size = 300001;
+    const size_t floats_size = 5002;
+    const size_t doubles_size = 140003;
+
+    unsigned int * uints;
+    float * floats;
+    double * doubles;
+    HIP_CHECK(hipMalloc(&uints, sizeof(unsigned int) * uints_size));
+    HIP_CHECK(hipMalloc(&floats, sizeof(float) * floats_size));
+    HIP_CHECK(hipMalloc(&doubles, sizeof(double) * doubles_size));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_PORTABLE));
+
+    ROCRAND_CHECK(rocrand_generate(generator, uints, uints_size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, floats, floats_size, 0.0f, 1.0f));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(generator, doubles, doubles_size));
+    // Small request after large ones
+    ROCRAND_CHECK(rocrand_generate(generator, uints, 7));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    host_uints.resize(uints_size);
+    host_floats.resize(floats_size);
+    host_doubles.resize(doubles_size);
+    HIP_CHECK(hipMemcpy(host_uints.data(), uints, sizeof(unsigned int) * uints_size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_floats.data(), floats, sizeof(float) * floats_size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_doubles.data(), doubles, sizeof(double) * doubles_size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(uints));
+    HIP_CHECK(hipFree(floats));
+    HIP_CHECK(hipFree(doubles));
+}
+
+// Results with ROCRAND_ORDERING_PSEUDO_PORTABLE must not depend on launch parameters
+void run_portable_test(rocrand_rng_type rng_type,
+                       const std::string& engine,
+                       const std::vector<grid_shape>& shapes)
+{
+    std::vector<unsigned int> expected_uints;
+    std::vector<float> expected_floats;
+    std::vector<double> expected_doubles;
+    generate_sequence(rng_type, engine, shapes[0], expected_uints, expected_floats, expected_doubles);
+
+    for(size_t s = 1; s < shapes.size(); s++)
+    {
+        SCOPED_TRACE(testing::Message() << "with threads = " << shapes[s].threads
+                                        << ", blocks = " << shapes[s].blocks);
+
+        std::vector<unsigned int> uints;
+        std::vector<float> floats;
+        std::vector<double> doubles;
+        generate_sequence(rng_type, engine, shapes[s], uints, floats, doubles);
+
+        for(size_t i = 0; i < uints.size(); i++)
+        {
+            ASSERT_EQ(uints[i], expected_uints[i]);
+        }
+        for(size_t i = 0; i < floats.size(); i++)
+        {
+            ASSERT_EQ(floats[i], expected_floats[i]);
+        }
+        for(size_t i = 0; i < doubles.size(); i++)
+        {
+            ASSERT_EQ(doubles[i], expected_doubles[i]);
+        }
+    }
+}
+
+TEST(rocrand_ordering_tests, xorwow_portable_test)
+{
+    run_portable_test(
+        ROCRAND_RNG_PSEUDO_XORWOW, "xorwow",
+        { { 256, 512 }, { 64, 64 }, { 96, 7 }, { 128, 1000 }, { 1024, 300 } }
+    );
+}
+
+TEST(rocrand_ordering_tests, mrg32k3a_portable_test)
+{
+    run_portable_test(
+        ROCRAND_RNG_PSEUDO_MRG32K3A, "mrg32k3a",
+        { { 256, 512 }, { 128, 128 }, { 96, 7 }, { 1024, 300 } }
+    );
+}
+
+TEST(rocrand_ordering_tests, philox_portable_test)
+{
+    // Number of blocks must be a multiple of 16
+    run_portable_test(
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10, "philox",
+        { { 256, 1024 }, { 64, 16 }, { 96, 48 }, { 128, 4096 } }
+    );
+}
+
+TEST(rocrand_ordering_tests, mtgp32_portable_test)
+{
+    // Number of threads is always 256
+    run_portable_test(
+        ROCRAND_RNG_PSEUDO_MTGP32, "mtgp32",
+        { { 256, 512 }, { 256, 64 }, { 256, 100 }, { 256, 1 } }
+    );
+}
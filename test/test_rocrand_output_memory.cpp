@@ -0,0 +1,190 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+class rocrand_output_memory_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Results of generate calls to device memory
+void generate_expected(rocrand_rng_type rng_type, size_t size,
+                       std::vector<unsigned int>& uints, std::vector<float>& floats)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    unsigned int * d_uints;
+    float * d_floats;
+    HIP_CHECK(hipMalloc(&d_uints, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc(&d_floats, size * sizeof(float)));
+    ROCRAND_CHECK(rocrand_generate(generator, d_uints, size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, d_floats, size, 1.0f, 2.0f));
+
+    uints.resize(size);
+    floats.resize(size);
+    HIP_CHECK(hipMemcpy(uints.data(), d_uints, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(floats.data(), d_floats, size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_uints));
+    HIP_CHECK(hipFree(d_floats));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+template<class T>
+void allocate(T ** ptr, size_t size, bool managed)
+{
+    if(managed)
+    {
+        HIP_CHECK(hipMallocManaged(ptr, size * sizeof(T)));
+    }
+    else
+    {
+        HIP_CHECK(hipHostMalloc(ptr, size * sizeof(T)));
+    }
+}
+
+template<class T>
+void deallocate(T * ptr, bool managed)
+{
+    if(managed)
+    {
+        HIP_CHECK(hipFree(ptr));
+    }
+    else
+    {
+        HIP_CHECK(hipHostFree(ptr));
+    }
+}
+
+// Generates to host-accessible memory and compares results with device memory
+void test_host_accessible_memory(rocrand_rng_type rng_type, bool managed)
+{
+    const size_t size = 123458;
+
+    std::vector<unsigned int> expected_uints;
+    std::vector<float> expected_floats;
+    generate_expected(rng_type, size, expected_uints, expected_floats);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    unsigned int * uints;
+    float * floats;
+    allocate(&uints, size, managed);
+    allocate(&floats, size, managed);
+    ROCRAND_CHECK(rocrand_generate(generator, uints, size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, floats, size, 1.0f, 2.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(uints[i], expected_uints[i]);
+        ASSERT_EQ(floats[i], expected_floats[i]);
+    }
+
+    deallocate(uints, managed);
+    deallocate(floats, managed);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_output_memory_tests, pinned_memory_test)
+{
+    test_host_accessible_memory(GetParam(), false);
+}
+
+TEST_P(rocrand_output_memory_tests, managed_memory_test)
+{
+    test_host_accessible_memory(GetParam(), true);
+}
+
+// The kind of memory is detected on every call, so one generator can switch
+// between device, pinned and managed buffers
+TEST_P(rocrand_output_memory_tests, switch_memory_test)
+{
+    const size_t size = 12346;
+
+    rocrand_generator generator;
+    rocrand_generator expected_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+    ROCRAND_CHECK(rocrand_create_generator(&expected_generator, GetParam()));
+
+    unsigned int * d_uints;
+    unsigned int * pinned_uints;
+    unsigned int * managed_uints;
+    HIP_CHECK(hipMalloc(&d_uints, size * sizeof(unsigned int)));
+    allocate(&pinned_uints, size, false);
+    allocate(&managed_uints, size, true);
+
+    std::vector<unsigned int> uints(size);
+    std::vector<unsigned int> expected_uints(size);
+    for(size_t call = 0; call < 3; call++)
+    {
+        ROCRAND_CHECK(rocrand_generate(expected_generator, d_uints, size));
+        HIP_CHECK(hipMemcpy(expected_uints.data(), d_uints, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        if(call == 0)
+        {
+            ROCRAND_CHECK(rocrand_generate(generator, pinned_uints, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            std::copy(pinned_uints, pinned_uints + size, uints.begin());
+        }
+        else if(call == 1)
+        {
+            ROCRAND_CHECK(rocrand_generate(generator, d_uints, size));
+            HIP_CHECK(hipMemcpy(uints.data(), d_uints, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        }
+        else
+        {
+            ROCRAND_CHECK(rocrand_generate(generator, managed_uints, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            std::copy(managed_uints, managed_uints + size, uints.begin());
+        }
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(uints[i], expected_uints[i]);
+        }
+    }
+
+    HIP_CHECK(hipFree(d_uints));
+    deallocate(pinned_uints, false);
+    deallocate(managed_uints, true);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(expected_generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_output_memory_tests,
+                        rocrand_output_memory_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,260 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// HIP graphs are available since HIP 4.3
+#if defined(HIP_VERSION) && HIP_VERSION >= 40300000
+
+struct capture_buffers
+{
+    static const size_t uints_size = 10000;
+    static const size_t floats_size = 5002;
+    // Poisson with two lambdas and negative binomial
+    static const size_t discrete_part_size = 4099;
+    static const size_t discrete_size = discrete_part_size * 3;
+
+    unsigned int * uints;
+    float * floats;
+    unsigned int * discrete;
+};
+
+// Sequence of generate calls which is captured
+void generate_sequence(rocrand_generator generator, const capture_buffers& buffers)
+{
+    ROCRAND_CHECK(rocrand_generate(generator, buffers.uints, buffers.uints_size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, buffers.floats, buffers.floats_size, 1.0f, 2.0f));
+    // Prepared tables are switched without allocations and copies
+    const size_t n = buffers.discrete_part_size;
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, buffers.discrete, n, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, buffers.discrete + n, n, 50.0));
+    ROCRAND_CHECK(rocrand_generate_negative_binomial(generator, buffers.discrete + 2 * n, n, 4.5, 0.2));
+}
+
+void copy_results(const capture_buffers& buffers,
+                  std::vector<unsigned int>& uints,
+                  std::vector<float>& floats,
+                  std::vector<unsigned int>& discrete)
+{
+    uints.resize(buffers.uints_size);
+    floats.resize(buffers.floats_size);
+    discrete.resize(buffers.discrete_size);
+    HIP_CHECK(hipMemcpy(uints.data(), buffers.uints, sizeof(unsigned int) * uints.size(), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(floats.data(), buffers.floats, sizeof(float) * floats.size(), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(discrete.data(), buffers.discrete, sizeof(unsigned int) * discrete.size(), hipMemcpyDeviceToHost));
+}
+
+void allocate_buffers(capture_buffers& buffers)
+{
+    HIP_CHECK(hipMalloc(&buffers.uints, sizeof(unsigned int) * buffers.uints_size));
+    HIP_CHECK(hipMalloc(&buffers.floats, sizeof(float) * buffers.floats_size));
+    HIP_CHECK(hipMalloc(&buffers.discrete, sizeof(unsigned int) * buffers.discrete_size));
+}
+
+void free_buffers(capture_buffers& buffers)
+{
+    HIP_CHECK(hipFree(buffers.uints));
+    HIP_CHECK(hipFree(buffers.floats));
+    HIP_CHECK(hipFree(buffers.discrete));
+}
+
+// Prepares the generator: initializes its state and creates tables
+void prepare_generator(rocrand_generator generator)
+{
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    ROCRAND_CHECK(rocrand_prepare_poisson(generator, 10.0));
+    ROCRAND_CHECK(rocrand_prepare_poisson(generator, 50.0));
+    ROCRAND_CHECK(rocrand_prepare_negative_binomial(generator, 4.5, 0.2));
+}
+
+void run_capture_test(rocrand_rng_type rng_type, bool replays_generate_new_numbers)
+{
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    capture_buffers buffers;
+    allocate_buffers(buffers);
+    capture_buffers expected_buffers;
+    allocate_buffers(expected_buffers);
+
+    // The same calls without capture
+    rocrand_generator expected_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&expected_generator, rng_type));
+    prepare_generator(expected_generator);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+    prepare_generator(generator);
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    // All operations must be capturable
+    hipGraph_t graph;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    generate_sequence(generator, buffers);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+
+    hipGraphExec_t graph_exec;
+    HIP_CHECK(hipGraphInstantiate(&graph_exec, graph, NULL, NULL, 0));
+
+    for(int replay = 0; replay < 3; replay++)
+    {
+        SCOPED_TRACE(testing::Message() << "with replay = " << replay);
+
+        HIP_CHECK(hipGraphLaunch(graph_exec, stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        if(replays_generate_new_numbers || replay == 0)
+        {
+            generate_sequence(expected_generator, expected_buffers);
+            HIP_CHECK(hipDeviceSynchronize());
+        }
+
+        std::vector<unsigned int> uints, expected_uints;
+        std::vector<float> floats, expected_floats;
+        std::vector<unsigned int> discrete, expected_discrete;
+        copy_results(buffers, uints, floats, discrete);
+        copy_results(expected_buffers, expected_uints, expected_floats, expected_discrete);
+
+        for(size_t i = 0; i < uints.size(); i++)
+        {
+            ASSERT_EQ(uints[i], expected_uints[i]);
+        }
+        for(size_t i = 0; i < floats.size(); i++)
+        {
+            ASSERT_EQ(floats[i], expected_floats[i]);
+        }
+        for(size_t i = 0; i < discrete.size(); i++)
+        {
+            ASSERT_EQ(discrete[i], expected_discrete[i]);
+        }
+    }
+
+    HIP_CHECK(hipGraphExecDestroy(graph_exec));
+    HIP_CHECK(hipGraphDestroy(graph));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(expected_generator));
+    free_buffers(buffers);
+    free_buffers(expected_buffers);
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST(rocrand_stream_capture_tests, xorwow_test)
+{
+    run_capture_test(ROCRAND_RNG_PSEUDO_XORWOW, true);
+}
+
+TEST(rocrand_stream_capture_tests, mrg32k3a_test)
+{
+    run_capture_test(ROCRAND_RNG_PSEUDO_MRG32K3A, true);
+}
+
+TEST(rocrand_stream_capture_tests, philox_test)
+{
+    run_capture_test(ROCRAND_RNG_PSEUDO_PHILOX4_32_10, true);
+}
+
+TEST(rocrand_stream_capture_tests, mtgp32_test)
+{
+    run_capture_test(ROCRAND_RNG_PSEUDO_MTGP32, true);
+}
+
+TEST(rocrand_stream_capture_tests, sobol32_test)
+{
+    // The offset is passed to kernels, replays generate the same numbers
+    run_capture_test(ROCRAND_RNG_QUASI_SOBOL32, false);
+}
+
+// Tables and states which are not prepared can not be created during capture,
+// generate calls fail without invalidating the capture
+TEST(rocrand_stream_capture_tests, not_prepared_test)
+{
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    const size_t size = 1024;
+    unsigned int * data;
+    double * paths;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+    HIP_CHECK(hipMalloc(&paths, sizeof(double) * size));
+
+    rocrand_generator philox;
+    ROCRAND_CHECK(rocrand_create_generator(&philox, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stream(philox, stream));
+    ROCRAND_CHECK(rocrand_initialize_generator(philox));
+    ROCRAND_CHECK(rocrand_prepare_poisson(philox, 10.0));
+
+    // MTGP32 states are not initialized
+    rocrand_generator mtgp32;
+    ROCRAND_CHECK(rocrand_create_generator(&mtgp32, ROCRAND_RNG_PSEUDO_MTGP32));
+    ROCRAND_CHECK(rocrand_set_stream(mtgp32, stream));
+
+    rocrand_generator sobol32;
+    ROCRAND_CHECK(rocrand_create_generator(&sobol32, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_stream(sobol32, stream));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(sobol32, 8));
+    ROCRAND_CHECK(rocrand_initialize_generator(sobol32));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    hipGraph_t graph;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    EXPECT_EQ(rocrand_generate_poisson(philox, data, size, 20.0), ROCRAND_STATUS_LAUNCH_FAILURE);
+    EXPECT_EQ(rocrand_generate_poisson(philox, data, size, 10.0), ROCRAND_STATUS_SUCCESS);
+    EXPECT_EQ(rocrand_generate(mtgp32, data, size), ROCRAND_STATUS_LAUNCH_FAILURE);
+    EXPECT_EQ(rocrand_generate_brownian_bridge_double(sobol32, paths, size, 1.0),
+              ROCRAND_STATUS_LAUNCH_FAILURE);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphDestroy(graph));
+
+    // The matrix is created before capture, it can not be freed during capture
+    ROCRAND_CHECK(rocrand_prepare_brownian_bridge(sobol32));
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    EXPECT_EQ(rocrand_generate_brownian_bridge_double(sobol32, paths, size, 1.0),
+              ROCRAND_STATUS_SUCCESS);
+    EXPECT_EQ(rocrand_release_prepared_tables(sobol32), ROCRAND_STATUS_LAUNCH_FAILURE);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphDestroy(graph));
+
+    // Released tables must be prepared again
+    ROCRAND_CHECK(rocrand_release_prepared_tables(philox));
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    EXPECT_EQ(rocrand_generate_poisson(philox, data, size, 10.0), ROCRAND_STATUS_LAUNCH_FAILURE);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphDestroy(graph));
+    EXPECT_EQ(rocrand_generate_poisson(philox, data, size, 10.0), ROCRAND_STATUS_SUCCESS);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(philox));
+    ROCRAND_CHECK(rocrand_destroy_generator(mtgp32));
+    ROCRAND_CHECK(rocrand_destroy_generator(sobol32));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(paths));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+#endif
@@ -0,0 +1,104 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+// Generates events in a child process, returns false if a call failed
+bool generate_events()
+{
+    const size_t size = 1024;
+    unsigned int * data;
+    if(hipMalloc(&data, size * sizeof(unsigned int)) != hipSuccess)
+        return false;
+
+    rocrand_generator generator;
+    bool ok = rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW) == ROCRAND_STATUS_SUCCESS;
+    ok = ok && rocrand_generate_poisson(generator, data, size, 100.0) == ROCRAND_STATUS_SUCCESS;
+    ok = ok && rocrand_generate_poisson(generator, data, size, 100.0) == ROCRAND_STATUS_SUCCESS;
+    // Invalid calls are not traced
+    ok = ok && rocrand_generate_poisson(generator, data, size, -1.0) == ROCRAND_STATUS_OUT_OF_RANGE;
+    ok = ok && rocrand_set_ordering(generator, ROCRAND_ORDERING_QUASI_DEFAULT) == ROCRAND_STATUS_OUT_OF_RANGE;
+    ok = ok && hipDeviceSynchronize() == hipSuccess;
+    ok = ok && rocrand_destroy_generator(generator) == ROCRAND_STATUS_SUCCESS;
+    return hipFree(data) == hipSuccess && ok;
+}
+
+// ROCRAND_TRACE is read once by the library and events are written to the file
+// when the process exits, so rocRAND functions are called in a child process
+TEST(rocrand_trace_tests, chrome_trace_events)
+{
+    const std::string path = "rocrand_test_trace.json";
+    ASSERT_EQ(setenv("ROCRAND_TRACE", path.c_str(), 1), 0);
+
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if(pid == 0)
+    {
+        // exit() (not _exit()) runs handlers which complete the file
+        exit(generate_events() ? 0 : 1);
+    }
+    int status;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    std::ifstream file(path.c_str());
+    ASSERT_TRUE(file.good());
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string trace = buffer.str();
+    remove(path.c_str());
+
+    EXPECT_EQ(trace.compare(0, 1, "["), 0);
+
+    // Counts events (lines) which contain all given strings
+    auto count = [&trace](const std::string& a, const std::string& b) -> int
+    {
+        std::istringstream lines(trace);
+        std::string line;
+        int n = 0;
+        while(std::getline(lines, line))
+        {
+            if(line.find(a) != std::string::npos && line.find(b) != std::string::npos)
+                n++;
+        }
+        return n;
+    };
+
+    EXPECT_EQ(count("\"name\":\"rocrand_create_generator\"", "\"engine\":\"xorwow\""), 1);
+    EXPECT_EQ(count("\"name\":\"rocrand_init\"", "\"engine\":\"xorwow\""), 1);
+    // Tables are computed only once for the same lambda
+    EXPECT_EQ(count("\"name\":\"rocrand_build_table\"", "\"distribution\":\"poisson\""), 1);
+    EXPECT_EQ(count("\"name\":\"rocrand_generate_poisson\"", "\"size\":1024"), 2);
+    EXPECT_EQ(count("\"name\":\"rocrand_set_ordering\"", "\"ph\":\"X\""), 0);
+    EXPECT_EQ(count("\"name\":\"rocrand_destroy_generator\"", "\"ph\":\"X\""), 1);
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+#include <random>
+
+#include <rng/distribution/truncated_normal.hpp>
+
+namespace
+{
+
+// Mean and variance of the normal distribution N(mean, stddev) truncated
+// to [lower, upper]
+void truncated_normal_moments(double mean, double stddev,
+                              double lower, double upper,
+                              double& expected_mean, double& expected_variance)
+{
+    const double a = (lower - mean) / stddev;
+    const double b = (upper - mean) / stddev;
+    const double pdf_a = std::exp(-0.5 * a * a) / std::sqrt(2.0 * M_PI);
+    const double pdf_b = std::exp(-0.5 * b * b) / std::sqrt(2.0 * M_PI);
+    // Avoid cancellation in the upper tail
+    const double z = a > 0.0
+        ? 0.5 * (std::erfc(a / std::sqrt(2.0)) - std::erfc(b / std::sqrt(2.0)))
+        : 0.5 * (std::erfc(-b / std::sqrt(2.0)) - std::erfc(-a / std::sqrt(2.0)));
+    const double d = (pdf_a - pdf_b) / z;
+    expected_mean = mean + stddev * d;
+    expected_variance = stddev * stddev * (1.0 + (a * pdf_a - b * pdf_b) / z - d * d);
+}
+
+} // end namespace
+
+const double intervals[][4] = {
+    // mean, stddev, lower, upper
+    { 0.0, 1.0, -1.0, 1.0 },
+    { 0.0, 1.0, 0.0, 100.0 },
+    { 2.0, 3.0, -10.0, 1.0 },
+    { 0.0, 1.0, 4.0, 5.0 },
+    { 0.0, 1.0, -9.0, -7.0 },
+    { -5.0, 0.5, -1.0, 0.0 },
+};
+
+template<class T>
+void run_truncated_normal_test()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<unsigned int> dis;
+
+    const size_t size = 100000;
+    for(auto& interval : intervals)
+    {
+        SCOPED_TRACE(testing::Message() << "interval = ["
+            << interval[2] << ", " << interval[3] << "], mean = "
+            << interval[0] << ", stddev = " << interval[1]);
+
+        truncated_normal_distribution<T> u(interval[0], interval[1], interval[2], interval[3]);
+
+        std::vector<T> val(size);
+        double mean = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            val[i] = u(dis(gen));
+            ASSERT_GE(val[i], static_cast<T>(interval[2]));
+            ASSERT_LE(val[i], static_cast<T>(interval[3]));
+            mean += val[i];
+        }
+        mean /= size;
+        double variance = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            variance += (val[i] - mean) * (val[i] - mean);
+        }
+        variance /= size;
+
+        double expected_mean, expected_variance;
+        truncated_normal_moments(interval[0], interval[1], interval[2], interval[3],
+                                 expected_mean, expected_variance);
+        const double expected_stddev = std::sqrt(expected_variance);
+        EXPECT_NEAR(mean, expected_mean, 0.02 * expected_stddev);
+        EXPECT_NEAR(std::sqrt(variance), expected_stddev, 0.02 * expected_stddev);
+    }
+}
+
+TEST(truncated_normal_distribution_tests, float_test)
+{
+    run_truncated_normal_test<float>();
+}
+
+TEST(truncated_normal_distribution_tests, double_test)
+{
+    run_truncated_normal_test<double>();
+}
+
+TEST(truncated_normal_distribution_tests, extreme_values_test)
+{
+    truncated_normal_distribution<float> uf(0.0f, 1.0f, 2.0f, 3.0f);
+    truncated_normal_distribution<double> ud(0.0, 1.0, 2.0, 3.0);
+    const unsigned int values[] = { 0U, 1U, 0x7fffffffU, 0xfffffffeU, 0xffffffffU };
+    for(unsigned int v : values)
+    {
+        EXPECT_GE(uf(v), 2.0f);
+        EXPECT_LE(uf(v), 3.0f);
+        EXPECT_GE(ud(v), 2.0);
+        EXPECT_LE(ud(v), 3.0);
+    }
+
+    // Inversion must be monotonic
+    for(unsigned int i = 0; i < 255; i++)
+    {
+        const unsigned int v = i << 24;
+        EXPECT_LE(uf(v), uf(v + (1U << 24)));
+        EXPECT_LE(ud(v), ud(v + (1U << 24)));
+    }
+}